@@ -0,0 +1,186 @@
+#include "agendador_analise.h"
+#include <stdexcept>
+#include <chrono>
+
+AgendadorAnalise::AgendadorAnalise(int numVertices) : n(numVertices), pedirGraus(false), numBFS(0) {}
+
+void AgendadorAnalise::validar(int vertice) const {
+    if (vertice < 1 || vertice > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+}
+
+void AgendadorAnalise::solicitarGraus() {
+    pedirGraus = true;
+}
+
+void AgendadorAnalise::solicitarOrdemBFS(int origem) {
+    validar(origem);
+    origensOrdemBFS.insert(origem);
+}
+
+void AgendadorAnalise::solicitarOrdemDFS(int origem) {
+    validar(origem);
+    origensDFS.insert(origem);
+}
+
+void AgendadorAnalise::solicitarDistancia(int origem, int destino) {
+    validar(origem);
+    validar(destino);
+    consultas.push_back({origem, destino});
+}
+
+void AgendadorAnalise::executar(const IGrafo& grafo) {
+    temposFases.clear();
+    ordensBFS.clear();
+    ordensDFS.clear();
+    distancias.clear();
+    numBFS = 0;
+
+    auto medir = [](chrono::high_resolution_clock::time_point inicio) {
+        auto fim = chrono::high_resolution_clock::now();
+        return chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+    };
+
+    // Passada única pela estrutura: graus e adjacência compacta
+    auto inicio = chrono::high_resolution_clock::now();
+    vector<long long> inicioVizinhos(n + 1, 0);
+    vector<int> vizinhos;
+    bool precisaAdjacencia = !origensOrdemBFS.empty() || !origensDFS.empty() || !consultas.empty();
+    if (pedirGraus || precisaAdjacencia) {
+        graus.assign(n, 0);
+        for (int v = 0; v < n; v++) {
+            if (!precisaAdjacencia) {
+                graus[v] = grafo.getGrau(v);
+                continue;
+            }
+            vector<int> lista = grafo.getVizinhos(v);
+            graus[v] = lista.size();
+            vizinhos.insert(vizinhos.end(), lista.begin(), lista.end());
+            inicioVizinhos[v + 1] = vizinhos.size();
+        }
+        temposFases.push_back({"Leitura da estrutura", medir(inicio)});
+    }
+
+    // Cada consulta é atendida por uma BFS que já vai rodar, pela origem ou pelo destino
+    set<int> origensBFS = origensOrdemBFS;
+    map<int, vector<pair<int, int>>> consultasPorOrigem; // origem da BFS -> (consulta, vértice lido)
+    for (const auto& consulta : consultas) {
+        auto [origem, destino] = consulta;
+        if (!origensBFS.count(origem) && origensBFS.count(destino)) {
+            consultasPorOrigem[destino].push_back({origem, destino});
+        } else {
+            origensBFS.insert(origem);
+            consultasPorOrigem[origem].push_back({origem, destino});
+        }
+    }
+
+    inicio = chrono::high_resolution_clock::now();
+    vector<int> nivel(n, -1);
+    vector<int> ordem;
+    for (int origem : origensBFS) {
+        int s = origem - 1;
+        ordem.clear();
+        nivel[s] = 0;
+        ordem.push_back(s);
+        for (size_t i = 0; i < ordem.size(); i++) {
+            int v = ordem[i];
+            for (long long e = inicioVizinhos[v]; e < inicioVizinhos[v + 1]; e++) {
+                int w = vizinhos[e];
+                if (nivel[w] == -1) {
+                    nivel[w] = nivel[v] + 1;
+                    ordem.push_back(w);
+                }
+            }
+        }
+        numBFS++;
+
+        for (const auto& consulta : consultasPorOrigem[origem]) {
+            int outro = consulta.first == origem ? consulta.second : consulta.first;
+            distancias[consulta] = nivel[outro - 1];
+        }
+        if (origensOrdemBFS.count(origem)) {
+            vector<int>& saida = ordensBFS[origem];
+            for (int v : ordem) {
+                saida.push_back(v + 1);
+            }
+        }
+        for (int v : ordem) {
+            nivel[v] = -1;
+        }
+    }
+    if (!origensBFS.empty()) {
+        temposFases.push_back({"BFS (" + to_string(numBFS) + " origens)", medir(inicio)});
+    }
+
+    // DFS com pilha, empilhando os vizinhos em ordem inversa como DFS::executarDFS
+    inicio = chrono::high_resolution_clock::now();
+    vector<bool> marcado(n, false);
+    vector<int> pilha;
+    for (int origem : origensDFS) {
+        vector<int>& saida = ordensDFS[origem];
+        pilha.push_back(origem - 1);
+        while (!pilha.empty()) {
+            int u = pilha.back();
+            pilha.pop_back();
+            if (marcado[u]) continue;
+            marcado[u] = true;
+            saida.push_back(u + 1);
+            for (long long e = inicioVizinhos[u + 1] - 1; e >= inicioVizinhos[u]; e--) {
+                if (!marcado[vizinhos[e]]) {
+                    pilha.push_back(vizinhos[e]);
+                }
+            }
+        }
+        for (int v : saida) {
+            marcado[v - 1] = false;
+        }
+    }
+    if (!origensDFS.empty()) {
+        temposFases.push_back({"DFS (" + to_string(origensDFS.size()) + " origens)", medir(inicio)});
+    }
+}
+
+const vector<int>& AgendadorAnalise::getGraus() const {
+    return graus;
+}
+
+const vector<int>& AgendadorAnalise::getOrdemBFS(int origem) const {
+    auto it = ordensBFS.find(origem);
+    if (it == ordensBFS.end()) {
+        throw invalid_argument("Ordem de BFS não solicitada para o vértice " + to_string(origem));
+    }
+    return it->second;
+}
+
+const vector<int>& AgendadorAnalise::getOrdemDFS(int origem) const {
+    auto it = ordensDFS.find(origem);
+    if (it == ordensDFS.end()) {
+        throw invalid_argument("Ordem de DFS não solicitada para o vértice " + to_string(origem));
+    }
+    return it->second;
+}
+
+int AgendadorAnalise::getDistancia(int origem, int destino) const {
+    auto it = distancias.find({origem, destino});
+    if (it == distancias.end()) {
+        throw invalid_argument("Distância não solicitada entre " + to_string(origem) + " e " + to_string(destino));
+    }
+    return it->second;
+}
+
+int AgendadorAnalise::getNumBFS() const {
+    return numBFS;
+}
+
+int AgendadorAnalise::getNumBFSSemAgendamento() const {
+    return origensOrdemBFS.size() + consultas.size();
+}
+
+int AgendadorAnalise::getNumDFS() const {
+    return origensDFS.size();
+}
+
+const vector<pair<string, double>>& AgendadorAnalise::getTemposFases() const {
+    return temposFases;
+}
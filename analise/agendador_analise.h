@@ -0,0 +1,70 @@
+#ifndef AGENDADOR_ANALISE_H
+#define AGENDADOR_ANALISE_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include "../representacao_leitura/grafo_interface.h"
+using namespace std;
+
+// Junta as métricas pedidas por uma análise e executa cada percurso uma só
+// vez. A estrutura é lida numa única passada (getVizinhos uma vez por
+// vértice), que dá os graus e uma cópia compacta da adjacência usada por
+// todas as buscas. Cada origem de BFS roda uma vez e atende tanto a ordem de
+// visitação quanto as distâncias que partem dela; como o grafo é não
+// direcionado, uma distância cujo destino já é origem de BFS é lida dessa
+// busca em vez de abrir outra. Ordens e distâncias são as mesmas das classes
+// BFS e DFS (vizinhos na ordem da estrutura). Vértices em base 1.
+class AgendadorAnalise {
+private:
+    int n;
+    bool pedirGraus;
+    set<int> origensOrdemBFS;
+    set<int> origensDFS;
+    vector<pair<int, int>> consultas;
+
+    vector<int> graus;
+    map<int, vector<int>> ordensBFS;
+    map<int, vector<int>> ordensDFS;
+    map<pair<int, int>, int> distancias;
+    int numBFS;
+    vector<pair<string, double>> temposFases;
+
+    void validar(int vertice) const;
+
+public:
+    AgendadorAnalise(int numVertices);
+
+    void solicitarGraus();
+
+    void solicitarOrdemBFS(int origem);
+
+    void solicitarOrdemDFS(int origem);
+
+    void solicitarDistancia(int origem, int destino);
+
+    void executar(const IGrafo& grafo);
+
+    const vector<int>& getGraus() const;
+
+    const vector<int>& getOrdemBFS(int origem) const;
+
+    const vector<int>& getOrdemDFS(int origem) const;
+
+    // -1 se destino não é alcançável
+    int getDistancia(int origem, int destino) const;
+
+    int getNumBFS() const;
+
+    // BFS que rodariam com uma busca por ordem pedida e outra por distância
+    int getNumBFSSemAgendamento() const;
+
+    int getNumDFS() const;
+
+    // (fase, ms) na ordem de execução
+    const vector<pair<string, double>>& getTemposFases() const;
+};
+
+#endif
@@ -0,0 +1,305 @@
+#include "centralidade.h"
+#include "../busca/execucao_paralela.h"
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <stdexcept>
+#include <queue>
+#include <random>
+#include <numeric>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+const double INFINITO = numeric_limits<double>::infinity();
+const double TOLERANCIA = 1e-9;
+
+// Buffers de uma thread, reutilizados entre as origens
+struct Trabalho {
+    vector<double> dist;
+    vector<double> sigma;        // número de caminhos mínimos a partir da origem
+    vector<double> dependencia;
+    vector<int> posicao;         // ordem de fechamento; -1 se não alcançado
+    vector<int> ordem;           // vértices na ordem em que foram fechados
+    vector<double> intermediacao;
+    vector<double> somaDistancias;
+    vector<double> alcancados;
+    vector<double> harmonica;
+
+    Trabalho(int n) : dist(n, INFINITO), sigma(n, 0.0), dependencia(n, 0.0), posicao(n, -1),
+                      intermediacao(n, 0.0), somaDistancias(n, 0.0), alcancados(n, 0.0), harmonica(n, 0.0) {}
+};
+
+bool mesmaDistancia(double a, double b) {
+    return fabs(a - b) <= TOLERANCIA * max(1.0, fabs(b));
+}
+} // namespace
+
+// Laços e arestas repetidas não criam caminhos mínimos novos; com peso, um
+// caminho mínimo só usaria a mais leve das arestas paralelas
+Centralidade::Centralidade(const IGrafo& grafo, int numThreads)
+    : n(grafo.getNumVertices()), comPeso(false), adjacencia(grafo) {
+    inicializar(numThreads);
+}
+
+Centralidade::Centralidade(const IGrafoPeso& grafo, int numThreads)
+    : n(grafo.getNumVertices()), comPeso(true), adjacencia(grafo) {
+    if (adjacencia.getMenorPeso() < 0) {
+        throw invalid_argument("Centralidade com Dijkstra exige pesos não negativos");
+    }
+    inicializar(numThreads);
+}
+
+void Centralidade::inicializar(int numThreads) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    numOrigens = 0;
+    epsilon = 0.0;
+    delta = 0.0;
+    tempoMs = 0.0;
+}
+
+void Centralidade::executar(const vector<int>& origens) {
+    auto tempoInicio = chrono::high_resolution_clock::now();
+    const vector<long long>& inicio = adjacencia.getInicio();
+    const vector<int>& vizinhos = adjacencia.getVizinhos();
+    const vector<double>& pesos = adjacencia.getPesos();
+
+    int total = origens.size();
+    int threads = max(1, min(numThreads, total));
+    double escala = total > 0 ? static_cast<double>(n) / total : 0.0;
+
+    vector<unique_ptr<Trabalho>> trabalhos(threads);
+    atomic<int> proxima(0);
+    exception_ptr erro = nullptr;
+    mutex mutexErro;
+
+    auto trabalhar = [&](int idThread) {
+        try {
+            trabalhos[idThread] = make_unique<Trabalho>(n);
+            Trabalho& t = *trabalhos[idThread];
+            using Entrada = pair<double, int>;
+            priority_queue<Entrada, vector<Entrada>, greater<Entrada>> heap;
+
+            for (int i = proxima.fetch_add(1); i < total; i = proxima.fetch_add(1)) {
+                int s = origens[i];
+                t.ordem.clear();
+                t.dist[s] = 0.0;
+
+                // Fechamento em ordem de distância (BFS ou Dijkstra)
+                if (!comPeso) {
+                    t.posicao[s] = 0;
+                    t.ordem.push_back(s);
+                    for (size_t j = 0; j < t.ordem.size(); j++) {
+                        int v = t.ordem[j];
+                        for (long long e = inicio[v]; e < inicio[v + 1]; e++) {
+                            int w = vizinhos[e];
+                            if (t.posicao[w] == -1) {
+                                t.dist[w] = t.dist[v] + 1;
+                                t.posicao[w] = t.ordem.size();
+                                t.ordem.push_back(w);
+                            }
+                        }
+                    }
+                } else {
+                    heap.push({0.0, s});
+                    while (!heap.empty()) {
+                        auto [d, v] = heap.top();
+                        heap.pop();
+                        if (t.posicao[v] != -1 || d > t.dist[v]) continue;
+                        t.posicao[v] = t.ordem.size();
+                        t.ordem.push_back(v);
+                        for (long long e = inicio[v]; e < inicio[v + 1]; e++) {
+                            int w = vizinhos[e];
+                            double nova = d + pesos[e];
+                            if (t.posicao[w] == -1 && nova < t.dist[w]) {
+                                t.dist[w] = nova;
+                                heap.push({nova, w});
+                            }
+                        }
+                    }
+                }
+
+                // Caminhos mínimos contados sobre o DAG da ordem de fechamento:
+                // u precede w se foi fechado antes e d(u) + peso = d(w). Assim
+                // arestas de peso zero não criam ciclos.
+                t.sigma[s] = 1.0;
+                for (size_t j = 1; j < t.ordem.size(); j++) {
+                    int w = t.ordem[j];
+                    for (long long e = inicio[w]; e < inicio[w + 1]; e++) {
+                        int u = vizinhos[e];
+                        double peso = comPeso ? pesos[e] : 1.0;
+                        if (t.posicao[u] != -1 && t.posicao[u] < t.posicao[w] &&
+                            mesmaDistancia(t.dist[u] + peso, t.dist[w])) {
+                            t.sigma[w] += t.sigma[u];
+                        }
+                    }
+                }
+
+                for (size_t j = t.ordem.size(); j-- > 0;) {
+                    int w = t.ordem[j];
+                    for (long long e = inicio[w]; e < inicio[w + 1]; e++) {
+                        int u = vizinhos[e];
+                        double peso = comPeso ? pesos[e] : 1.0;
+                        if (t.posicao[u] != -1 && t.posicao[u] < t.posicao[w] &&
+                            mesmaDistancia(t.dist[u] + peso, t.dist[w])) {
+                            t.dependencia[u] += t.sigma[u] / t.sigma[w] * (1.0 + t.dependencia[w]);
+                        }
+                    }
+                    if (w != s) {
+                        t.intermediacao[w] += escala * t.dependencia[w];
+                    }
+                }
+
+                // Distâncias são simétricas: a origem contribui para cada vértice alcançado
+                for (int v : t.ordem) {
+                    t.somaDistancias[v] += escala * t.dist[v];
+                    t.alcancados[v] += escala;
+                    if (v != s && t.dist[v] > 0.0) {
+                        t.harmonica[v] += escala / t.dist[v];
+                    }
+                }
+
+                for (int v : t.ordem) {
+                    t.dist[v] = INFINITO;
+                    t.sigma[v] = 0.0;
+                    t.dependencia[v] = 0.0;
+                    t.posicao[v] = -1;
+                }
+            }
+        } catch (...) {
+            lock_guard<mutex> trava(mutexErro);
+            if (!erro) erro = current_exception();
+            proxima.store(total); // interrompe as demais threads
+        }
+    };
+
+    vector<thread> trabalhadores;
+    for (int t = 1; t < threads; t++) {
+        trabalhadores.emplace_back(trabalhar, t);
+    }
+    trabalhar(0);
+    for (auto& t : trabalhadores) {
+        t.join();
+    }
+    if (erro) {
+        rethrow_exception(erro);
+    }
+
+    intermediacao.assign(n, 0.0);
+    proximidade.assign(n, 0.0);
+    harmonica.assign(n, 0.0);
+
+    // Cada par não ordenado aparece nas duas direções
+    double paresBetweenness = n > 2 ? (n - 1.0) * (n - 2.0) : 0.0;
+    for (int v = 0; v < n; v++) {
+        double soma = 0.0, alcancados = 0.0, harm = 0.0, inter = 0.0;
+        for (const auto& t : trabalhos) {
+            if (!t) continue;
+            inter += t->intermediacao[v];
+            soma += t->somaDistancias[v];
+            alcancados += t->alcancados[v];
+            harm += t->harmonica[v];
+        }
+        intermediacao[v] = paresBetweenness > 0 ? inter / paresBetweenness : 0.0;
+        proximidade[v] = soma > 0 ? max(0.0, alcancados - 1.0) / soma : 0.0;
+        harmonica[v] = n > 1 ? harm / (n - 1) : 0.0;
+    }
+
+    numOrigens = total;
+    auto tempoFim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(tempoFim - tempoInicio).count() / 1000.0;
+}
+
+void Centralidade::calcularExato() {
+    vector<int> origens(n);
+    iota(origens.begin(), origens.end(), 0);
+    epsilon = 0.0;
+    delta = 0.0;
+    executar(origens);
+}
+
+int Centralidade::origensNecessarias(int numVertices, double epsilon, double delta) {
+    if (epsilon <= 0.0 || delta <= 0.0 || delta >= 1.0) {
+        throw invalid_argument("Use 0 < epsilon e 0 < delta < 1");
+    }
+    double k = ceil(log(2.0 * max(numVertices, 1) / delta) / (2.0 * epsilon * epsilon));
+    return k >= numVertices ? numVertices : static_cast<int>(k);
+}
+
+void Centralidade::calcularAmostrado(double epsilon, double delta, unsigned int semente) {
+    int k = origensNecessarias(n, epsilon, delta);
+    if (k >= n) {
+        calcularExato();
+        return;
+    }
+
+    vector<int> origens(n);
+    iota(origens.begin(), origens.end(), 0);
+    mt19937 gerador(semente);
+    // Fisher-Yates parcial: só as k primeiras posições importam
+    for (int i = 0; i < k; i++) {
+        uniform_int_distribution<int> sorteio(i, n - 1);
+        swap(origens[i], origens[sorteio(gerador)]);
+    }
+    origens.resize(k);
+
+    this->epsilon = epsilon;
+    this->delta = delta;
+    executar(origens);
+}
+
+const vector<double>& Centralidade::getIntermediacao() const {
+    return intermediacao;
+}
+
+const vector<double>& Centralidade::getProximidade() const {
+    return proximidade;
+}
+
+const vector<double>& Centralidade::getHarmonica() const {
+    return harmonica;
+}
+
+vector<pair<int, double>> Centralidade::maiores(const vector<double>& valores, int k) {
+    vector<int> indices(valores.size());
+    iota(indices.begin(), indices.end(), 0);
+    k = max(0, min(k, static_cast<int>(indices.size())));
+
+    partial_sort(indices.begin(), indices.begin() + k, indices.end(), [&](int a, int b) {
+        return valores[a] > valores[b] || (valores[a] == valores[b] && a < b);
+    });
+
+    vector<pair<int, double>> resultado;
+    for (int i = 0; i < k; i++) {
+        resultado.push_back({indices[i] + 1, valores[indices[i]]});
+    }
+    return resultado;
+}
+
+int Centralidade::getNumOrigens() const {
+    return numOrigens;
+}
+
+bool Centralidade::isAmostrado() const {
+    return epsilon > 0.0;
+}
+
+double Centralidade::getEpsilon() const {
+    return epsilon;
+}
+
+double Centralidade::getDelta() const {
+    return delta;
+}
+
+int Centralidade::getNumThreads() const {
+    return numThreads;
+}
+
+double Centralidade::getTempoMs() const {
+    return tempoMs;
+}
@@ -0,0 +1,79 @@
+#ifndef CENTRALIDADE_H
+#define CENTRALIDADE_H
+
+#include <vector>
+#include <utility>
+#include "../representacao_leitura/grafo_interface.h"
+#include "../representacao_leitura/grafo_peso_interface.h"
+#include "../representacao_leitura/grafo_simples.h"
+using namespace std;
+
+// Centralidades de grafos não direcionados, por BFS (sem peso) ou Dijkstra
+// (com peso), com uma busca por origem distribuída entre as threads:
+// - intermediação (betweenness) pelo acúmulo de dependências de Brandes;
+// - proximidade (closeness): (alcançados - 1) / soma das distâncias, como em
+//   DijkstraParalelo::calcularResumos;
+// - harmônica: soma de 1 / d(v, u) sobre u != v, dividida por n - 1.
+// A intermediação sai normalizada por (n - 1)(n - 2) / 2, então tudo fica em
+// [0, 1]. No modo amostrado, k origens sorteadas sem reposição representam
+// todas (peso n / k); pela desigualdade de Hoeffding com união sobre os n
+// vértices, k = ln(2n / delta) / (2 epsilon^2) garante, com probabilidade
+// >= 1 - delta, erro absoluto <= epsilon * n / (n - 1) na intermediação e na
+// harmônica de todos os vértices. A proximidade amostrada é a estimativa de
+// Eppstein e Wang (soma das distâncias extrapolada da amostra).
+class Centralidade {
+private:
+    int n;
+    bool comPeso;
+    int numThreads;
+
+    GrafoSimples adjacencia;
+
+    vector<double> intermediacao;
+    vector<double> proximidade;
+    vector<double> harmonica;
+    int numOrigens;
+    double epsilon; // 0 no cálculo exato
+    double delta;
+    double tempoMs;
+
+    void inicializar(int numThreads);
+
+    void executar(const vector<int>& origens);
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    Centralidade(const IGrafo& grafo, int numThreads = 0);
+    Centralidade(const IGrafoPeso& grafo, int numThreads = 0);
+
+    // Uma busca por vértice
+    void calcularExato();
+
+    // Amostra o número de origens exigido por (epsilon, delta); se passar de
+    // n, cai no cálculo exato
+    void calcularAmostrado(double epsilon, double delta, unsigned int semente = 1234567);
+
+    static int origensNecessarias(int numVertices, double epsilon, double delta);
+
+    // Vetores em base 0
+    const vector<double>& getIntermediacao() const;
+    const vector<double>& getProximidade() const;
+    const vector<double>& getHarmonica() const;
+
+    // Os k maiores valores como (vértice em base 1, valor), em ordem decrescente
+    static vector<pair<int, double>> maiores(const vector<double>& valores, int k);
+
+    int getNumOrigens() const;
+
+    bool isAmostrado() const;
+
+    double getEpsilon() const;
+
+    double getDelta() const;
+
+    int getNumThreads() const;
+
+    double getTempoMs() const;
+};
+
+#endif
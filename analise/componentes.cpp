@@ -1,12 +1,14 @@
 #include "componentes.h"
 #include "../busca/dfs.h"
+#include "uniao_busca.h"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
+#include <stdexcept>
 
 ComponentesConexas::ComponentesConexas(int numVertices) : n(numVertices) {
-    visitado.resize(n, false);
+    componenteDoVertice.assign(n, -1);
     componentes.clear();
 }
 
@@ -18,24 +20,29 @@ const vector<Componente>& ComponentesConexas::getComponentes() const {
     return componentes;
 }
 
+const int* ComponentesConexas::getVertices(const Componente& comp) const {
+    return verticesAgrupados.data() + comp.inicio;
+}
+
+const vector<int>& ComponentesConexas::getVerticesAgrupados() const {
+    return verticesAgrupados;
+}
+
+size_t ComponentesConexas::getMemoriaBytes() const {
+    return componentes.size() * sizeof(Componente) +
+           (componenteDoVertice.size() + verticesAgrupados.size()) * sizeof(int);
+}
+
 int ComponentesConexas::getComponenteDoVertice(int vertice) const {
     if (vertice < 1 || vertice > n) {
         return -1;
     }
-
-    for (const auto& comp : componentes) {
-        for (int v : comp.vertices) {
-            if (v == vertice) {
-                return comp.id;
-            }
-        }
-    }
-    return -1;
+    return componenteDoVertice[vertice - 1];
 }
 
 bool ComponentesConexas::estaoConectados(int v1, int v2) const {
-    return getComponenteDoVertice(v1) == getComponenteDoVertice(v2) &&
-           getComponenteDoVertice(v1) != -1;
+    int c1 = getComponenteDoVertice(v1);
+    return c1 != -1 && c1 == getComponenteDoVertice(v2);
 }
 
 void ComponentesConexas::imprimirComponentes() const {
@@ -46,9 +53,10 @@ void ComponentesConexas::imprimirComponentes() const {
     for (const auto& comp : componentes) {
         cout << "Componente " << comp.id << " (tamanho: " << comp.tamanho << "):\n";
         cout << "Vértices: ";
-        for (size_t i = 0; i < comp.vertices.size(); i++) {
+        const int* vertices = getVertices(comp);
+        for (int i = 0; i < comp.tamanho; i++) {
             if (i > 0) cout << ", ";
-            cout << comp.vertices[i];
+            cout << vertices[i];
         }
         cout << "\n\n";
     }
@@ -75,9 +83,10 @@ void ComponentesConexas::salvarResultado(const string& nomeArquivo) const {
         arquivo << "Componente " << comp.id << ":\n";
         arquivo << "- Tamanho: " << comp.tamanho << " vértices\n";
         arquivo << "- Vértices: ";
-        for (size_t i = 0; i < comp.vertices.size(); i++) {
+        const int* vertices = getVertices(comp);
+        for (int i = 0; i < comp.tamanho; i++) {
             if (i > 0) arquivo << ", ";
-            arquivo << comp.vertices[i];
+            arquivo << vertices[i];
         }
         arquivo << "\n";
         arquivo << "- Porcentagem do grafo: "
@@ -134,8 +143,9 @@ void ComponentesConexas::imprimirEstatisticas() const {
 }
 
 void ComponentesConexas::reset() {
-    fill(visitado.begin(), visitado.end(), false);
     componentes.clear();
+    componenteDoVertice.assign(n, -1);
+    verticesAgrupados.clear();
 }
 
 // Implementação do método genérico usando interface IGrafo
@@ -143,36 +153,96 @@ void ComponentesConexas::encontrarComponentes(const IGrafo& grafo) {
     reset();
 
     DFS dfs(n);
-    int id_componente = 1;
+    vector<int> rotulos(n, -1);
 
     for (int v = 0; v < n; v++) {
-        if (!visitado[v]) {
+        if (rotulos[v] == -1) {
 
             dfs.reset();
             dfs.executarDFS(grafo, v + 1); // Convertendo para base 1 para DFS
 
-            const vector<int>& ordem_visitacao = dfs.getOrdemVisitacao();
-
-            for (int vertice_1based : ordem_visitacao) {
-                int vertice_0based = vertice_1based - 1;
-                visitado[vertice_0based] = true;
+            for (int vertice_1based : dfs.getOrdemVisitacao()) {
+                rotulos[vertice_1based - 1] = v;
             }
+        }
+    }
+
+    montarDeRotulos(rotulos);
+}
+
+void ComponentesConexas::encontrarComponentes(const DadosGrafo& dados) {
+    if (dados.numVertices != n) {
+        throw invalid_argument("Número de vértices não corresponde");
+    }
 
-            componentes.emplace_back(id_componente++, ordem_visitacao);
+    reset();
+
+    UniaoBusca conjuntos(n);
+    for (const auto& [u, v] : dados.arestas) {
+        if (u < 1 || u > n || v < 1 || v > n) {
+            throw invalid_argument("Vértice inválido");
+        }
+        conjuntos.unir(u - 1, v - 1);
+    }
+
+    vector<int> rotulos(n);
+    for (int v = 0; v < n; v++) {
+        rotulos[v] = conjuntos.encontrar(v);
+    }
+    montarDeRotulos(rotulos);
+}
+
+void ComponentesConexas::montarDeRotulos(const vector<int>& rotulos) {
+    if (static_cast<int>(rotulos.size()) != n) {
+        throw invalid_argument("Número de vértices não corresponde");
+    }
+
+    reset();
+
+    // Percorrendo em ordem crescente, cada componente aparece pelo seu menor
+    // vértice; componenteDoVertice guarda por enquanto o índice provisório
+    vector<int> indiceDoRotulo(n, -1);
+    vector<int> tamanhos;
+    for (int v = 0; v < n; v++) {
+        int rotulo = rotulos[v];
+        if (rotulo < 0 || rotulo >= n) {
+            throw invalid_argument("Rótulo de componente inválido");
         }
+        if (indiceDoRotulo[rotulo] == -1) {
+            indiceDoRotulo[rotulo] = tamanhos.size();
+            tamanhos.push_back(0);
+        }
+        componenteDoVertice[v] = indiceDoRotulo[rotulo];
+        tamanhos[componenteDoVertice[v]]++;
     }
 
-    // Ordena componentes por tamanho (maior primeiro) e depois por menor vértice
-    sort(componentes.begin(), componentes.end(),
-         [](const Componente& a, const Componente& b) {
-             if (a.tamanho != b.tamanho) {
-                 return a.tamanho > b.tamanho;
-             }
-             return a.vertices[0] < b.vertices[0];
-         });
+    // Ordena componentes por tamanho (maior primeiro) e depois por menor
+    // vértice, que é a ordem de descoberta
+    vector<int> ordem(tamanhos.size());
+    for (size_t i = 0; i < ordem.size(); i++) {
+        ordem[i] = i;
+    }
+    stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+        return tamanhos[a] > tamanhos[b];
+    });
+
+    vector<int> idDoIndice(tamanhos.size());
+    vector<int> proximaPosicao(tamanhos.size());
+    componentes.reserve(tamanhos.size());
+    int inicio = 0;
+    for (size_t i = 0; i < ordem.size(); i++) {
+        int indice = ordem[i];
+        componentes.push_back({static_cast<int>(i) + 1, tamanhos[indice], inicio});
+        idDoIndice[indice] = i + 1;
+        proximaPosicao[indice] = inicio;
+        inicio += tamanhos[indice];
+    }
 
-    // Renumera os IDs dos componentes após ordenação
-    for (size_t i = 0; i < componentes.size(); i++) {
-        componentes[i].id = i + 1;
+    // Distribui os vértices em ordem crescente: cada grupo já sai ordenado
+    verticesAgrupados.resize(n);
+    for (int v = 0; v < n; v++) {
+        int indice = componenteDoVertice[v];
+        verticesAgrupados[proximaPosicao[indice]++] = v + 1;
+        componenteDoVertice[v] = idDoIndice[indice];
     }
 }
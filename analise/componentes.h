@@ -3,28 +3,29 @@
 
 #include <vector>
 #include <string>
-#include <algorithm>
+#include <cstddef>
 #include "../representacao_leitura/grafo_interface.h"
 #include "../representacao_leitura/matriz_adjacencia.h"
 #include "../representacao_leitura/lista_adjacencia.h"
+#include "../representacao_leitura/leitor_grafo.h"
 using namespace std;
 
+// Vértices da componente: getVertices(comp)[0 .. tamanho), em ordem crescente
 struct Componente {
     int id;
     int tamanho;
-    vector<int> vertices;
-
-    Componente(int _id, const vector<int>& _vertices)
-        : id(_id), tamanho(_vertices.size()), vertices(_vertices) {
-        sort(vertices.begin(), vertices.end());
-    }
+    int inicio; // posição do primeiro vértice em verticesAgrupados
 };
 
+// Componentes guardadas de forma compacta: um rótulo por vértice e um único
+// vetor com os vértices agrupados por componente (tabela de deslocamentos em
+// Componente::inicio). Consultas de pertinência e conectividade são O(1).
 class ComponentesConexas {
 private:
     int n;
     vector<Componente> componentes;
-    vector<bool> visitado;
+    vector<int> componenteDoVertice; // ID (base 1) por vértice em base 0
+    vector<int> verticesAgrupados;   // vértices em base 1, componente a componente
 
 public:
 
@@ -33,10 +34,26 @@ public:
     // Método genérico usando interface IGrafo
     void encontrarComponentes(const IGrafo& grafo);
 
+    // Union-find direto sobre a lista de arestas, sem montar adjacência;
+    // produz as mesmas componentes, na mesma ordem e numeração
+    void encontrarComponentes(const DadosGrafo& dados);
+
+    // Monta as componentes a partir de um rótulo por vértice: um vértice
+    // representante em base 0, o mesmo para toda a componente. Ordena por
+    // tamanho (maior primeiro) e menor vértice, e numera os IDs a partir de 1
+    void montarDeRotulos(const vector<int>& rotulos);
+
     int getNumComponentes() const;
 
     const vector<Componente>& getComponentes() const;
 
+    // Primeiro dos comp.tamanho vértices (base 1) da componente
+    const int* getVertices(const Componente& comp) const;
+
+    const vector<int>& getVerticesAgrupados() const;
+
+    size_t getMemoriaBytes() const;
+
     int getComponenteDoVertice(int vertice) const;
 
     bool estaoConectados(int v1, int v2) const;
@@ -0,0 +1,135 @@
+#include "componentes_paralelo.h"
+#include "../busca/execucao_paralela.h"
+#include <atomic>
+#include <unordered_map>
+#include <random>
+#include <chrono>
+#include <algorithm>
+
+namespace {
+const int TAMANHO_LOTE = 4096;
+
+// Une as árvores de u e v pendurando a raiz de maior índice na de menor
+void ligar(vector<atomic<int>>& comp, int u, int v) {
+    int p1 = comp[u].load(memory_order_relaxed);
+    int p2 = comp[v].load(memory_order_relaxed);
+    while (p1 != p2) {
+        int alto = max(p1, p2);
+        int baixo = min(p1, p2);
+        int paiAlto = comp[alto].load(memory_order_relaxed);
+
+        if (paiAlto == baixo) break;
+        if (paiAlto == alto &&
+            comp[alto].compare_exchange_strong(paiAlto, baixo, memory_order_acq_rel)) {
+            break;
+        }
+
+        p1 = comp[comp[alto].load(memory_order_relaxed)].load(memory_order_relaxed);
+        p2 = comp[baixo].load(memory_order_relaxed);
+    }
+}
+
+void comprimir(vector<atomic<int>>& comp, int n, int numThreads) {
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int inicio, int fim, int) {
+        for (int v = inicio; v < fim; v++) {
+            int pai = comp[v].load(memory_order_relaxed);
+            while (pai != comp[pai].load(memory_order_relaxed)) {
+                pai = comp[pai].load(memory_order_relaxed);
+            }
+            comp[v].store(pai, memory_order_relaxed);
+        }
+    });
+}
+} // namespace
+
+ComponentesParalelo::ComponentesParalelo(int numThreads) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    tempoMs = 0.0;
+    fracaoIgnorada = 0.0;
+}
+
+vector<int> ComponentesParalelo::calcularRotulos(const GrafoCSR& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    int n = grafo.getNumVertices();
+    vector<atomic<int>> comp(n);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+        for (int v = ini; v < fim; v++) {
+            comp[v].store(v, memory_order_relaxed);
+        }
+    });
+
+    // Fase 1: amostragem de vizinhos
+    for (int rodada = 0; rodada < RODADAS_VIZINHOS; rodada++) {
+        ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+            for (int u = ini; u < fim; u++) {
+                if (rodada < grafo.getGrau(u)) {
+                    ligar(comp, u, grafo.getVizinhos(u)[rodada]);
+                }
+            }
+        });
+        comprimir(comp, n, numThreads);
+    }
+
+    // Fase 2: rótulo mais frequente numa amostra
+    int frequente = -1;
+    if (n > 0) {
+        mt19937 gerador(27491095);
+        uniform_int_distribution<int> sorteio(0, n - 1);
+        unordered_map<int, int> contagem;
+        int melhor = 0;
+        for (int i = 0; i < NUM_AMOSTRAS; i++) {
+            int rotulo = comp[sorteio(gerador)].load(memory_order_relaxed);
+            if (++contagem[rotulo] > melhor) {
+                melhor = contagem[rotulo];
+                frequente = rotulo;
+            }
+        }
+    }
+
+    // Fase 3: restante da vizinhança, fora da componente amostrada. Arestas
+    // entre ela e outro vértice são cobertas pelo lado de fora, já que o
+    // grafo guarda as duas direções.
+    atomic<long long> ignorados(0);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+        long long locais = 0;
+        for (int u = ini; u < fim; u++) {
+            if (comp[u].load(memory_order_relaxed) == frequente) {
+                locais++;
+                continue;
+            }
+            const int* vizinhos = grafo.getVizinhos(u);
+            for (int i = RODADAS_VIZINHOS; i < grafo.getGrau(u); i++) {
+                ligar(comp, u, vizinhos[i]);
+            }
+        }
+        ignorados.fetch_add(locais, memory_order_relaxed);
+    });
+    comprimir(comp, n, numThreads);
+
+    vector<int> rotulos(n);
+    for (int v = 0; v < n; v++) {
+        rotulos[v] = comp[v].load(memory_order_relaxed);
+    }
+
+    fracaoIgnorada = n > 0 ? static_cast<double>(ignorados.load()) / n : 0.0;
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+    return rotulos;
+}
+
+void ComponentesParalelo::encontrarComponentes(const GrafoCSR& grafo, ComponentesConexas& componentes) {
+    componentes.montarDeRotulos(calcularRotulos(grafo));
+}
+
+int ComponentesParalelo::getNumThreads() const {
+    return numThreads;
+}
+
+double ComponentesParalelo::getTempoMs() const {
+    return tempoMs;
+}
+
+double ComponentesParalelo::getFracaoIgnorada() const {
+    return fracaoIgnorada;
+}
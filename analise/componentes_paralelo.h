@@ -0,0 +1,44 @@
+#ifndef COMPONENTES_PARALELO_H
+#define COMPONENTES_PARALELO_H
+
+#include <vector>
+#include "../representacao_leitura/grafo_csr.h"
+#include "componentes.h"
+using namespace std;
+
+// Componentes conexas em paralelo pelo Afforest (Sutton et al., 2018):
+// 1. cada vértice é ligado aos seus primeiros RODADAS_VIZINHOS vizinhos,
+//    com compressão de caminho entre as rodadas;
+// 2. uma amostra de rótulos aponta a componente mais frequente (quase sempre
+//    a gigante), cujos vértices já não precisam ser examinados;
+// 3. os demais vértices ligam o restante da vizinhança e os rótulos são
+//    comprimidos até a raiz.
+// As ligações sempre apontam o maior índice para o menor via compare-and-swap,
+// então as threads nunca formam ciclos. O resultado final é convertido pela
+// ComponentesConexas, com a mesma ordem e numeração das versões sequenciais.
+class ComponentesParalelo {
+private:
+    static constexpr int RODADAS_VIZINHOS = 2;
+    static constexpr int NUM_AMOSTRAS = 1024;
+
+    int numThreads;
+    double tempoMs;
+    double fracaoIgnorada; // vértices da componente amostrada que pularam a fase 3
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    ComponentesParalelo(int numThreads = 0);
+
+    // Um vértice representante (base 0) por vértice
+    vector<int> calcularRotulos(const GrafoCSR& grafo);
+
+    void encontrarComponentes(const GrafoCSR& grafo, ComponentesConexas& componentes);
+
+    int getNumThreads() const;
+
+    double getTempoMs() const;
+
+    double getFracaoIgnorada() const;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "conectividade_incremental.h"
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+
+ConectividadeIncremental::ConectividadeIncremental(int numVertices)
+    : n(numVertices), conjuntos(numVertices) {
+    maiorComponente = n > 0 ? 1 : 0;
+    totalArestas = 0;
+    tempoTotalMs = 0.0;
+}
+
+EstatisticasLote ConectividadeIncremental::inserirArestas(const vector<pair<int, int>>& arestas) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    EstatisticasLote lote{static_cast<long long>(arestas.size()), 0, 0.0, 0.0};
+    for (const auto& [u, v] : arestas) {
+        if (u < 1 || u > n || v < 1 || v > n) {
+            throw invalid_argument("Vértice inválido");
+        }
+        if (conjuntos.unir(u - 1, v - 1)) {
+            lote.unioes++;
+            maiorComponente = max(maiorComponente, conjuntos.getTamanhoConjunto(u - 1));
+        }
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    lote.tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+    lote.arestasPorSegundo = lote.tempoMs > 0 ? lote.arestas / (lote.tempoMs / 1000.0) : 0.0;
+
+    totalArestas += lote.arestas;
+    tempoTotalMs += lote.tempoMs;
+    return lote;
+}
+
+bool ConectividadeIncremental::estaoConectados(int v1, int v2) {
+    if (v1 < 1 || v1 > n || v2 < 1 || v2 > n) {
+        return false;
+    }
+    return conjuntos.mesmoConjunto(v1 - 1, v2 - 1);
+}
+
+int ConectividadeIncremental::getNumComponentes() const {
+    return conjuntos.getNumConjuntos();
+}
+
+int ConectividadeIncremental::getTamanhoComponente(int vertice) {
+    if (vertice < 1 || vertice > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+    return conjuntos.getTamanhoConjunto(vertice - 1);
+}
+
+int ConectividadeIncremental::getMaiorComponente() const {
+    return maiorComponente;
+}
+
+vector<int> ConectividadeIncremental::getTamanhosComponentes() {
+    vector<int> tamanhos;
+    tamanhos.reserve(conjuntos.getNumConjuntos());
+    for (int v = 0; v < n; v++) {
+        if (conjuntos.encontrar(v) == v) {
+            tamanhos.push_back(conjuntos.getTamanhoConjunto(v));
+        }
+    }
+    sort(tamanhos.rbegin(), tamanhos.rend());
+    return tamanhos;
+}
+
+void ConectividadeIncremental::exportar(ComponentesConexas& componentes) {
+    vector<int> rotulos(n);
+    for (int v = 0; v < n; v++) {
+        rotulos[v] = conjuntos.encontrar(v);
+    }
+    componentes.montarDeRotulos(rotulos);
+}
+
+long long ConectividadeIncremental::getTotalArestas() const {
+    return totalArestas;
+}
+
+double ConectividadeIncremental::getArestasPorSegundo() const {
+    return tempoTotalMs > 0 ? totalArestas / (tempoTotalMs / 1000.0) : 0.0;
+}
@@ -0,0 +1,54 @@
+#ifndef CONECTIVIDADE_INCREMENTAL_H
+#define CONECTIVIDADE_INCREMENTAL_H
+
+#include <vector>
+#include <utility>
+#include "uniao_busca.h"
+#include "componentes.h"
+using namespace std;
+
+struct EstatisticasLote {
+    long long arestas;      // arestas do lote
+    long long unioes;       // arestas que juntaram duas componentes
+    double tempoMs;
+    double arestasPorSegundo;
+};
+
+// Conectividade sob inserção de arestas em lotes: um union-find mantém
+// número de componentes, tamanhos e a maior componente sem recalcular nada
+// do zero. Só inserções são suportadas; remoções exigem reconstruir.
+// Vértices em base 1.
+class ConectividadeIncremental {
+private:
+    int n;
+    UniaoBusca conjuntos;
+    int maiorComponente; // tamanho; só cresce com inserções
+    long long totalArestas;
+    double tempoTotalMs;
+
+public:
+    ConectividadeIncremental(int numVertices);
+
+    EstatisticasLote inserirArestas(const vector<pair<int, int>>& arestas);
+
+    bool estaoConectados(int v1, int v2);
+
+    int getNumComponentes() const;
+
+    int getTamanhoComponente(int vertice);
+
+    int getMaiorComponente() const;
+
+    // Tamanhos de todas as componentes, do maior para o menor (O(n))
+    vector<int> getTamanhosComponentes();
+
+    // Estado atual no formato de ComponentesConexas (mesma ordem e numeração)
+    void exportar(ComponentesConexas& componentes);
+
+    long long getTotalArestas() const;
+
+    // Vazão acumulada desde a criação
+    double getArestasPorSegundo() const;
+};
+
+#endif
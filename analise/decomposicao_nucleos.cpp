@@ -0,0 +1,207 @@
+#include "decomposicao_nucleos.h"
+#include "../representacao_leitura/grafo_simples.h"
+#include "../busca/execucao_paralela.h"
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+const int TAMANHO_LOTE = 2048;
+} // namespace
+
+DecomposicaoNucleos::DecomposicaoNucleos(int numThreads) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    degeneracao = 0;
+    numRodadas = 0;
+    tempoMs = 0.0;
+}
+
+void DecomposicaoNucleos::calcular(const GrafoCSR& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    GrafoSimples adj(grafo);
+    const vector<long long>& inicioAdj = adj.getInicio();
+    const vector<int>& vizinhosAdj = adj.getVizinhos();
+    int n = grafo.getNumVertices();
+    int maiorGrau = 0;
+    vector<int> grau(n);
+    for (int v = 0; v < n; v++) {
+        grau[v] = adj.getGrau(v);
+        maiorGrau = max(maiorGrau, grau[v]);
+    }
+
+    // Ordenação por contagem: inicioFaixa[d] é a primeira posição com grau d
+    vector<int> inicioFaixa(maiorGrau + 2, 0);
+    for (int v = 0; v < n; v++) {
+        inicioFaixa[grau[v] + 1]++;
+    }
+    for (int d = 0; d <= maiorGrau; d++) {
+        inicioFaixa[d + 1] += inicioFaixa[d];
+    }
+    vector<int> ordem(n), posicao(n);
+    vector<int> proximaPosicao(inicioFaixa.begin(), inicioFaixa.end() - 1);
+    for (int v = 0; v < n; v++) {
+        posicao[v] = proximaPosicao[grau[v]]++;
+        ordem[posicao[v]] = v;
+    }
+
+    // Ao processar v, grau[v] é o seu núcleo; vizinhos de grau maior descem
+    // uma faixa trocando de lugar com o primeiro vértice da própria faixa
+    for (int i = 0; i < n; i++) {
+        int v = ordem[i];
+        for (long long e = inicioAdj[v]; e < inicioAdj[v + 1]; e++) {
+            int u = vizinhosAdj[e];
+            if (grau[u] > grau[v]) {
+                int du = grau[u];
+                int pu = posicao[u];
+                int pw = inicioFaixa[du];
+                int w = ordem[pw];
+                if (u != w) {
+                    swap(ordem[pu], ordem[pw]);
+                    posicao[u] = pw;
+                    posicao[w] = pu;
+                }
+                inicioFaixa[du]++;
+                grau[u]--;
+            }
+        }
+    }
+
+    nucleo = move(grau);
+    numRodadas = 0;
+    finalizar();
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+void DecomposicaoNucleos::calcularParalelo(const GrafoCSR& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    GrafoSimples adj(grafo);
+    const vector<long long>& inicioAdj = adj.getInicio();
+    const vector<int>& vizinhosAdj = adj.getVizinhos();
+    int n = grafo.getNumVertices();
+    vector<atomic<int>> grau(n);
+    vector<int> resultado(n, -1);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+        for (int v = ini; v < fim; v++) {
+            grau[v].store(adj.getGrau(v), memory_order_relaxed);
+        }
+    });
+
+    vector<int> restantes(n);
+    for (int v = 0; v < n; v++) {
+        restantes[v] = v;
+    }
+    vector<vector<int>> locais(numThreads);
+    numRodadas = 0;
+
+    auto juntar = [&]() {
+        vector<int> todos;
+        for (auto& local : locais) {
+            todos.insert(todos.end(), local.begin(), local.end());
+            local.clear();
+        }
+        return todos;
+    };
+
+    for (int k = 0; !restantes.empty(); k++) {
+        // Fronteira inicial da camada: grau atual <= k
+        ExecucaoParalela::paraCadaLote(restantes.size(), numThreads, TAMANHO_LOTE, [&](int ini, int fim, int idThread) {
+            for (int i = ini; i < fim; i++) {
+                int v = restantes[i];
+                if (grau[v].load(memory_order_relaxed) <= k) {
+                    resultado[v] = k;
+                    locais[idThread].push_back(v);
+                }
+            }
+        });
+        vector<int> fronteira = juntar();
+
+        while (!fronteira.empty()) {
+            numRodadas++;
+            ExecucaoParalela::paraCadaLote(fronteira.size(), numThreads, TAMANHO_LOTE, [&](int ini, int fim, int idThread) {
+                for (int i = ini; i < fim; i++) {
+                    int v = fronteira[i];
+                    for (long long e = inicioAdj[v]; e < inicioAdj[v + 1]; e++) {
+                        int u = vizinhosAdj[e];
+                        if (grau[u].load(memory_order_relaxed) <= k) continue;
+                        // Só a thread que leva o grau exatamente a k enfileira u
+                        int anterior = grau[u].fetch_sub(1, memory_order_relaxed);
+                        if (anterior == k + 1) {
+                            resultado[u] = k;
+                            locais[idThread].push_back(u);
+                        } else if (anterior <= k) {
+                            grau[u].fetch_add(1, memory_order_relaxed);
+                        }
+                    }
+                }
+            });
+            fronteira = juntar();
+        }
+
+        restantes.erase(remove_if(restantes.begin(), restantes.end(),
+                                  [&](int v) { return resultado[v] != -1; }),
+                        restantes.end());
+    }
+
+    nucleo = move(resultado);
+    finalizar();
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+void DecomposicaoNucleos::finalizar() {
+    degeneracao = 0;
+    for (int k : nucleo) {
+        degeneracao = max(degeneracao, k);
+    }
+    verticesPorNucleo.assign(degeneracao + 1, 0);
+    for (int k : nucleo) {
+        verticesPorNucleo[k]++;
+    }
+}
+
+int DecomposicaoNucleos::getNucleo(int vertice) const {
+    if (vertice < 1 || vertice > static_cast<int>(nucleo.size())) {
+        throw invalid_argument("Vértice inválido");
+    }
+    return nucleo[vertice - 1];
+}
+
+const vector<int>& DecomposicaoNucleos::getNucleos() const {
+    return nucleo;
+}
+
+int DecomposicaoNucleos::getDegeneracao() const {
+    return degeneracao;
+}
+
+const vector<int>& DecomposicaoNucleos::getVerticesPorNucleo() const {
+    return verticesPorNucleo;
+}
+
+vector<int> DecomposicaoNucleos::getTamanhosKNucleos() const {
+    vector<int> tamanhos(verticesPorNucleo.size(), 0);
+    int acumulado = 0;
+    for (int k = static_cast<int>(verticesPorNucleo.size()) - 1; k >= 0; k--) {
+        acumulado += verticesPorNucleo[k];
+        tamanhos[k] = acumulado;
+    }
+    return tamanhos;
+}
+
+int DecomposicaoNucleos::getNumRodadas() const {
+    return numRodadas;
+}
+
+int DecomposicaoNucleos::getNumThreads() const {
+    return numThreads;
+}
+
+double DecomposicaoNucleos::getTempoMs() const {
+    return tempoMs;
+}
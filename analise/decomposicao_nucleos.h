@@ -0,0 +1,55 @@
+#ifndef DECOMPOSICAO_NUCLEOS_H
+#define DECOMPOSICAO_NUCLEOS_H
+
+#include <vector>
+#include "../representacao_leitura/grafo_csr.h"
+using namespace std;
+
+// Decomposição em k-núcleos: o núcleo de v é o maior k tal que v pertence a
+// um subgrafo em que todo vértice tem grau >= k. Laços e arestas repetidas
+// do arquivo são ignorados.
+// - calcular: Batagelj e Zaversnik (2003), O(n + m). Os vértices ficam num
+//   vetor ordenado por grau com o início de cada faixa de grau; remover o
+//   de menor grau e decrementar um vizinho é uma troca de posições.
+// - calcularParalelo: remoção em camadas (peeling). Para k = 0, 1, ... a
+//   fronteira com grau atual <= k é removida em paralelo, e os vizinhos cujo
+//   grau cai para k entram na fronteira seguinte da mesma camada.
+class DecomposicaoNucleos {
+private:
+    int numThreads;
+    vector<int> nucleo;            // base 0
+    int degeneracao;               // maior núcleo
+    vector<int> verticesPorNucleo; // [k] = vértices com núcleo exatamente k
+    int numRodadas;                // fronteiras processadas no modo paralelo
+    double tempoMs;
+
+    void finalizar();
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    DecomposicaoNucleos(int numThreads = 0);
+
+    void calcular(const GrafoCSR& grafo);
+
+    void calcularParalelo(const GrafoCSR& grafo);
+
+    // Vértice em base 1
+    int getNucleo(int vertice) const;
+
+    const vector<int>& getNucleos() const;
+
+    int getDegeneracao() const;
+
+    const vector<int>& getVerticesPorNucleo() const;
+
+    // [k] = tamanho do k-núcleo (vértices com núcleo >= k)
+    vector<int> getTamanhosKNucleos() const;
+
+    int getNumRodadas() const;
+
+    int getNumThreads() const;
+
+    double getTempoMs() const;
+};
+
+#endif
@@ -1,12 +1,15 @@
 #include "distancias.h"
+#include "matriz_distancias.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
 #include <iomanip>
+#include <chrono>
 
 Distancias::Distancias(int numVertices) : n(numVertices) {
     diametro = 0;
     vertices_diametro = {-1, -1};
+    numBuscasDiametro = 0;
 }
 
 vector<int> Distancias::bfs_distancias_matriz(const MatrizAdjacencia& matriz, int origem) {
@@ -99,6 +102,182 @@ void Distancias::calcularDistancias(const IGrafo& grafo) {
          << " (vértices " << vertices_diametro.first << " e " << vertices_diametro.second << ")\n";
 }
 
+int Distancias::bfsExcentricidade(const IGrafo& grafo, int origem, vector<int>& dist,
+                                  vector<int>& pai, vector<int>& fila) const {
+    fila.clear();
+    fila.push_back(origem);
+    dist[origem] = 0;
+    pai[origem] = -1;
+
+    for (size_t i = 0; i < fila.size(); i++) {
+        int atual = fila[i];
+        for (int vizinho : grafo.getVizinhos(atual)) {
+            if (dist[vizinho] == INFINITO) {
+                dist[vizinho] = dist[atual] + 1;
+                pai[vizinho] = atual;
+                fila.push_back(vizinho);
+            }
+        }
+    }
+
+    return dist[fila.back()];
+}
+
+void Distancias::calcularDiametroExato(const IGrafo& grafo) {
+    diametro = 0;
+    vertices_diametro = {1, 1};
+    numBuscasDiametro = 0;
+
+    vector<int> dist(n, INFINITO);
+    vector<int> pai(n, -1);
+    vector<int> fila;
+    vector<bool> componenteVisitada(n, false);
+
+    auto limpar = [&]() {
+        for (int v : fila) dist[v] = INFINITO;
+    };
+    auto registrar = [&](int excentricidade, int a, int b) {
+        if (excentricidade > diametro) {
+            diametro = excentricidade;
+            vertices_diametro = {a + 1, b + 1};
+        }
+    };
+
+    for (int s = 0; s < n; s++) {
+        if (componenteVisitada[s]) continue;
+
+        // Vértices da componente e, entre eles, o de maior grau
+        bfsExcentricidade(grafo, s, dist, pai, fila);
+        numBuscasDiametro++;
+        vector<int> componente = fila;
+        limpar();
+        for (int v : componente) componenteVisitada[v] = true;
+        if (componente.size() <= 2) {
+            registrar(componente.size() - 1, componente.front(), componente.back());
+            continue;
+        }
+
+        int maiorGrau = s;
+        size_t grauMaximo = 0;
+        for (int v : componente) {
+            size_t grau = grafo.getGrau(v);
+            if (grau > grauMaximo) {
+                grauMaximo = grau;
+                maiorGrau = v;
+            }
+        }
+
+        // Varredura dupla: a é o mais distante do vértice de maior grau, b o
+        // mais distante de a; o meio do caminho a-b costuma ser bem central
+        bfsExcentricidade(grafo, maiorGrau, dist, pai, fila);
+        int a = fila.back();
+        limpar();
+
+        int limiteInferior = bfsExcentricidade(grafo, a, dist, pai, fila);
+        int b = fila.back();
+        registrar(limiteInferior, a, b);
+        int u = b;
+        for (int passo = 0; passo < limiteInferior / 2; passo++) {
+            u = pai[u];
+        }
+        limpar();
+        numBuscasDiametro += 2;
+
+        // Níveis da BFS a partir de u; o iFUB examina as franjas de fora para
+        // dentro até o limite superior 2(i-1) não superar o melhor já visto
+        int i = bfsExcentricidade(grafo, u, dist, pai, fila);
+        numBuscasDiametro++;
+        vector<vector<int>> franjas(i + 1);
+        for (int v : fila) {
+            franjas[dist[v]].push_back(v);
+        }
+        limpar();
+        registrar(i, u, franjas[i].front());
+        limiteInferior = max(limiteInferior, i);
+
+        int limiteSuperior = 2 * i;
+        while (limiteSuperior > limiteInferior) {
+            for (int x : franjas[i]) {
+                int excentricidade = bfsExcentricidade(grafo, x, dist, pai, fila);
+                numBuscasDiametro++;
+                if (excentricidade > limiteInferior) {
+                    limiteInferior = excentricidade;
+                    registrar(excentricidade, x, fila.back());
+                }
+                limpar();
+            }
+            if (limiteInferior > 2 * (i - 1)) {
+                break;
+            }
+            i--;
+            limiteSuperior = 2 * i;
+        }
+    }
+
+    cout << "✅ Diâmetro exato (iFUB): " << diametro
+         << " (vértices " << vertices_diametro.first << " e " << vertices_diametro.second << ", "
+         << numBuscasDiametro << " buscas em largura)\n";
+}
+
+void Distancias::salvarResultado(const GrafoCSR& grafo, const string& nomeArquivo, int numThreads) {
+    MatrizDistancias matriz(numThreads);
+    size_t limiteRAM = static_cast<size_t>(n) * n * sizeof(int);
+    cout << "🔄 Gravando matriz de distâncias em " << nomeArquivo << " ("
+         << matriz.getNumThreads() << " threads; como int em memória seriam "
+         << fixed << setprecision(1) << limiteRAM / (1024.0 * 1024.0) << " MB)...\n";
+
+    auto inicio = chrono::high_resolution_clock::now();
+    matriz.gerar(grafo, nomeArquivo, [&inicio](int concluidas, int total) {
+        double segundos = chrono::duration_cast<chrono::microseconds>(
+            chrono::high_resolution_clock::now() - inicio).count() / 1e6;
+        cout << "\r   " << setw(3) << (100LL * concluidas / total) << "% (" << concluidas << "/" << total
+             << " origens, " << setprecision(0) << concluidas / max(segundos, 1e-6) << " origens/s)" << flush;
+    });
+    cout << "\n";
+
+    diametro = matriz.getMaiorDistancia();
+    vertices_diametro = matriz.getVerticesMaiorDistancia();
+
+    double segundos = max(matriz.getTempoMs() / 1000.0, 1e-6);
+    cout << "✅ Matriz gravada: " << setprecision(1) << matriz.getBytesEscritos() / (1024.0 * 1024.0) << " MB ("
+         << matriz.getBytesPorEntrada() << " byte(s) por entrada) em " << setprecision(3)
+         << matriz.getTempoMs() << " ms\n";
+    cout << "   Vazão: " << setprecision(0) << n / segundos << " origens/s, " << setprecision(1)
+         << matriz.getBytesEscritos() / (1024.0 * 1024.0) / segundos << " MB/s\n";
+    cout << "   Memória de trabalho: " << matriz.getMemoriaTrabalhoBytes() / (1024.0 * 1024.0) << " MB";
+    long pico = MatrizDistancias::lerPicoMemoriaKB();
+    if (pico >= 0) {
+        cout << " (pico do processo: " << pico / 1024.0 << " MB)";
+    }
+    cout << "\n";
+    cout << "   Maior distância finita: " << diametro << " (vértices " << vertices_diametro.first
+         << " e " << vertices_diametro.second << ")\n";
+}
+
+void Distancias::imprimirMatrizDistancias(const string& nomeArquivo, int limite) const {
+    int total = MatrizDistancias::lerNumVertices(nomeArquivo);
+    int mostrar = min(limite, total);
+
+    cout << "📋 Matriz de distâncias (" << mostrar << " x " << mostrar << " de " << total << " x " << total << "):\n";
+    cout << "     ";
+    for (int j = 1; j <= mostrar; j++) {
+        cout << setw(4) << j;
+    }
+    cout << "\n";
+    for (int i = 1; i <= mostrar; i++) {
+        vector<int> linha = MatrizDistancias::lerLinha(nomeArquivo, i);
+        cout << setw(4) << i << " ";
+        for (int j = 0; j < mostrar; j++) {
+            if (linha[j] == -1) {
+                cout << "   ∞";
+            } else {
+                cout << setw(4) << linha[j];
+            }
+        }
+        cout << "\n";
+    }
+}
+
 int Distancias::calcularDistanciaEspecifica(const IGrafo& grafo, int origem, int destino) const {
     vector<int> distancias = const_cast<Distancias*>(this)->bfs_distancias(grafo, origem);
     
@@ -122,3 +301,7 @@ int Distancias::getDiametro() const {
 pair<int, int> Distancias::getVerticesDiametro() const {
     return vertices_diametro;
 }
+
+int Distancias::getNumBuscasDiametro() const {
+    return numBuscasDiametro;
+}
@@ -7,6 +7,7 @@
 #include "../representacao_leitura/grafo_interface.h"
 #include "../representacao_leitura/matriz_adjacencia.h"
 #include "../representacao_leitura/lista_adjacencia.h"
+#include "../representacao_leitura/grafo_csr.h"
 #include "../busca/bfs.h"
 using namespace std;
 
@@ -15,6 +16,14 @@ private:
     int n;
     int diametro;
     pair<int, int> vertices_diametro;
+    int numBuscasDiametro;
+
+    // BFS a partir de origem (base 0) que só toca a componente da origem:
+    // dist deve chegar todo em INFINITO e é restaurado pelo chamador a partir
+    // de fila, que termina com os vértices em ordem de visita. Retorna a
+    // excentricidade da origem; o vértice mais distante é fila.back()
+    int bfsExcentricidade(const IGrafo& grafo, int origem, vector<int>& dist,
+                          vector<int>& pai, vector<int>& fila) const;
 
     vector<int> bfs_distancias_matriz(const MatrizAdjacencia& matriz, int origem);
     vector<int> bfs_distancias_lista(const ListaAdjacencia& lista, int origem);
@@ -30,6 +39,10 @@ public:
 
     // Métodos genéricos usando interface IGrafo
     void calcularDistancias(const IGrafo& grafo);
+
+    // Diâmetro exato pelo iFUB, componente a componente: a maior distância
+    // finita, como em calcularDistancias, mas em geral com poucas BFS
+    void calcularDiametroExato(const IGrafo& grafo);
     vector<int> bfs_distancias(const IGrafo& grafo, int origem);
     int calcularDistanciaEspecifica(const IGrafo& grafo, int origem, int destino) const;
     int getDistancia(const IGrafo& grafo, int origem, int destino) const;
@@ -38,11 +51,17 @@ public:
 
     pair<int, int> getVerticesDiametro() const;
 
-    void imprimirMatrizDistancias() const;
+    // BFS executadas pela última chamada de calcularDiametroExato
+    int getNumBuscasDiametro() const;
+
+    // Primeiras "limite" linhas e colunas de uma matriz gravada por salvarResultado
+    void imprimirMatrizDistancias(const string& nomeArquivo, int limite = 20) const;
 
     void imprimirDiametro() const;
 
-    void salvarResultado(const string& nomeArquivo) const;
+    // Matriz de distâncias completa em arquivo binário (ver MatrizDistancias),
+    // com BFS paralelas por origem; também atualiza o diâmetro
+    void salvarResultado(const GrafoCSR& grafo, const string& nomeArquivo, int numThreads = 0);
 
     bool isConexo_Lista(const ListaAdjacencia& lista) const;
     bool isConexo_Matriz(const MatrizAdjacencia& matriz) const;
@@ -3,7 +3,23 @@
 #include <fstream>
 #include <algorithm>
 #include <iomanip>
-#include <numeric>
+
+namespace {
+// Origens das buscas da análise completa e vértices consultados a partir delas (base 1)
+const vector<int> VERTICES_INICIAIS = {1, 2, 3};
+const vector<int> VERTICES_CONSULTA = {10, 20, 30};
+
+// Pares de distâncias específicas válidos para n vértices
+vector<pair<int, int>> paresEspecificos(int n) {
+    vector<pair<int, int>> pares;
+    for (const auto& par : vector<pair<int, int>>{{1, n / 2}, {1, n - 1}, {n / 4, 3 * n / 4}}) {
+        if (par.first >= 1 && par.second >= 1 && par.first <= n && par.second <= n) {
+            pares.push_back(par);
+        }
+    }
+    return pares;
+}
+} // namespace
 
 Estatisticas::Estatisticas(int numVertices) : n(numVertices) {
     stats.numVertices = numVertices;
@@ -18,41 +34,68 @@ Estatisticas::Estatisticas(int numVertices) : n(numVertices) {
     stats.menorComponente = 0;
     stats.diametro = 0;
     stats.verticesDiametro = {-1, -1};
+    stats.raio = 0;
+    stats.buscasExcentricidades = 0;
+    stats.temDistribuicaoAproximada = false;
+    stats.paresAlcancaveis = 0.0;
+    stats.distanciaMedia = 0.0;
+    stats.desvioDistanciaMedia = 0.0;
+    stats.diametroEfetivo = 0.0;
+    stats.desvioDiametroEfetivo = 0.0;
+    stats.erroRelativoPares = 0.0;
+    stats.registradoresHyperANF = 0;
+    stats.repeticoesHyperANF = 0;
+    stats.temTriangulos = false;
+    stats.numTriangulos = 0;
+    stats.coeficienteAgrupamentoMedio = 0.0;
+    stats.transitividade = 0.0;
+    stats.temNucleos = false;
+    stats.degeneracao = 0;
 }
 
+// Uma passada acumula mínimo, máximo, soma e o histograma; a mediana sai do
+// histograma em O(grau máximo), sem ordenar os graus
 void Estatisticas::calcularEstatisticasGrau(const vector<int>& graus) {
     stats.graus = graus;
+    stats.histogramaGraus.clear();
+    if (graus.empty()) return;
+
+    int grauMinimo = graus[0], grauMaximo = graus[0];
+    long long somaGraus = 0;
+    for (int g : graus) {
+        grauMinimo = min(grauMinimo, g);
+        grauMaximo = max(grauMaximo, g);
+        somaGraus += g;
+        if (g >= static_cast<int>(stats.histogramaGraus.size())) {
+            stats.histogramaGraus.resize(max(g + 1, 2 * static_cast<int>(stats.histogramaGraus.size())), 0);
+        }
+        stats.histogramaGraus[g]++;
+    }
+    stats.histogramaGraus.resize(grauMaximo + 1);
 
-    auto minMax = minmax_element(graus.begin(), graus.end());
-    stats.grauMinimo = *minMax.first;
-    stats.grauMaximo = *minMax.second;
-
-    int somaGraus = accumulate(graus.begin(), graus.end(), 0);
+    stats.grauMinimo = grauMinimo;
+    stats.grauMaximo = grauMaximo;
     stats.grauMedio = static_cast<double>(somaGraus) / n;
-
-    stats.medianaGrau = calcularMediana(graus);
+    stats.medianaGrau = calcularMediana(stats.histogramaGraus, graus.size());
 }
 
-double Estatisticas::calcularMediana(const vector<int>& graus) {
-    if (graus.empty()) return 0.0;
-
-    vector<int> valores = graus;
-    size_t tamanho = valores.size();
-
-    if (tamanho % 2 == 0) {
+double Estatisticas::calcularMediana(const vector<int>& histograma, int total) {
+    if (total == 0) return 0.0;
 
-        nth_element(valores.begin(), valores.begin() + tamanho/2 - 1, valores.end());
-        int primeiro = valores[tamanho/2 - 1];
-
-        nth_element(valores.begin(), valores.begin() + tamanho/2, valores.end());
-        int segundo = valores[tamanho/2];
-
-        return (primeiro + segundo) / 2.0;
-    } else {
+    // Valor na posição k (base 0) da sequência ordenada
+    auto valorNaPosicao = [&](int k) {
+        int acumulado = 0;
+        for (size_t g = 0; g < histograma.size(); g++) {
+            acumulado += histograma[g];
+            if (acumulado > k) return static_cast<int>(g);
+        }
+        return static_cast<int>(histograma.size()) - 1;
+    };
 
-        nth_element(valores.begin(), valores.begin() + tamanho/2, valores.end());
-        return valores[tamanho/2];
+    if (total % 2 == 0) {
+        return (valorNaPosicao(total/2 - 1) + valorNaPosicao(total/2)) / 2.0;
     }
+    return valorNaPosicao(total/2);
 }
 
 void Estatisticas::adicionarInformacoesComponentes(const ComponentesConexas& componentes) {
@@ -72,6 +115,36 @@ void Estatisticas::adicionarInformacoesComponentes(const ComponentesConexas& com
     }
 }
 
+void Estatisticas::adicionarDistribuicaoDistancias(const HyperANF& hyperANF) {
+    stats.temDistribuicaoAproximada = true;
+    stats.paresPorDistancia = hyperANF.getParesPorDistancia();
+    stats.paresAlcancaveis = hyperANF.getParesAlcancaveis();
+    stats.distanciaMedia = hyperANF.getDistanciaMedia();
+    stats.desvioDistanciaMedia = hyperANF.getDesvioDistanciaMedia();
+    stats.diametroEfetivo = hyperANF.getDiametroEfetivo();
+    stats.desvioDiametroEfetivo = hyperANF.getDesvioDiametroEfetivo();
+    stats.erroRelativoPares = hyperANF.getErroRelativo();
+    stats.registradoresHyperANF = hyperANF.getNumRegistradores();
+    stats.repeticoesHyperANF = hyperANF.getRepeticoes();
+}
+
+void Estatisticas::adicionarTriangulos(const ContagemTriangulos& triangulos) {
+    stats.temTriangulos = true;
+    stats.numTriangulos = triangulos.getNumTriangulos();
+    stats.triangulosPorVertice = triangulos.getTriangulosPorVertice();
+    stats.coeficientesAgrupamento = triangulos.getCoeficientesLocais();
+    stats.coeficienteAgrupamentoMedio = triangulos.getCoeficienteMedio();
+    stats.transitividade = triangulos.getTransitividade();
+}
+
+void Estatisticas::adicionarNucleos(const DecomposicaoNucleos& decomposicao) {
+    stats.temNucleos = true;
+    stats.nucleos = decomposicao.getNucleos();
+    stats.degeneracao = decomposicao.getDegeneracao();
+    stats.verticesPorNucleo = decomposicao.getVerticesPorNucleo();
+    stats.tamanhosKNucleos = decomposicao.getTamanhosKNucleos();
+}
+
 void Estatisticas::imprimirEstatisticas() const {
     cout << "📊 ESTATÍSTICAS DO GRAFO\n";
     cout << "========================\n";
@@ -117,6 +190,72 @@ void Estatisticas::imprimirEstatisticas() const {
         }
     }
     cout << "\n";
+
+    cout << "🎯 EXCENTRICIDADES\n";
+    cout << "==================\n";
+    if (!stats.isConexo) {
+        cout << "• Raio e centro referem-se à maior componente\n";
+    }
+    cout << "• Raio: " << stats.raio << "\n";
+    cout << "• Centro (" << stats.centro.size() << " vértices): ";
+    for (size_t i = 0; i < stats.centro.size() && i < 10; i++) {
+        if (i > 0) cout << ", ";
+        cout << stats.centro[i];
+    }
+    if (stats.centro.size() > 10) cout << ", ...";
+    cout << "\n";
+    cout << "• Distribuição das excentricidades:\n";
+    for (size_t e = 0; e < stats.histogramaExcentricidades.size(); e++) {
+        if (stats.histogramaExcentricidades[e] > 0) {
+            cout << "    " << e << ": " << stats.histogramaExcentricidades[e] << " vértices\n";
+        }
+    }
+    cout << "• BFS executadas: " << stats.buscasExcentricidades
+         << " (de " << stats.numVertices << " vértices)\n";
+    cout << "\n";
+
+    if (stats.temTriangulos) {
+        cout << "🔺 TRIÂNGULOS E AGRUPAMENTO\n";
+        cout << "==========================\n";
+        cout << "• Triângulos: " << stats.numTriangulos << "\n";
+        cout << "• Coeficiente de agrupamento médio: " << fixed << setprecision(4)
+             << stats.coeficienteAgrupamentoMedio << "\n";
+        cout << "• Transitividade (global): " << stats.transitividade << "\n";
+        cout << "\n";
+    }
+
+    if (stats.temNucleos) {
+        cout << "🧅 K-NÚCLEOS\n";
+        cout << "===========\n";
+        cout << "• Degeneração: " << stats.degeneracao << "\n";
+        cout << "• Núcleo mais denso: " << stats.tamanhosKNucleos[stats.degeneracao] << " vértices\n";
+        cout << "• Distribuição (núcleo: vértices | tamanho do k-núcleo):\n";
+        for (size_t k = 0; k < stats.verticesPorNucleo.size(); k++) {
+            if (stats.verticesPorNucleo[k] > 0) {
+                cout << "    " << k << ": " << stats.verticesPorNucleo[k]
+                     << " | " << stats.tamanhosKNucleos[k] << "\n";
+            }
+        }
+        cout << "\n";
+    }
+
+    if (stats.temDistribuicaoAproximada) {
+        cout << "📈 DISTRIBUIÇÃO DE DISTÂNCIAS (HyperANF, estimada)\n";
+        cout << "=================================================\n";
+        cout << "• " << stats.registradoresHyperANF << " registradores por contador, "
+             << stats.repeticoesHyperANF << " repetições\n";
+        cout << "• Pares conectados: " << fixed << setprecision(0) << stats.paresAlcancaveis
+             << " (±" << setprecision(1) << 100.0 * stats.erroRelativoPares << "%)\n";
+        cout << "• Distância média: " << setprecision(3) << stats.distanciaMedia
+             << " ± " << stats.desvioDistanciaMedia << "\n";
+        cout << "• Diâmetro efetivo (90%): " << stats.diametroEfetivo
+             << " ± " << stats.desvioDiametroEfetivo << "\n";
+        cout << "• Pares por distância:\n";
+        for (size_t t = 1; t < stats.paresPorDistancia.size(); t++) {
+            cout << "    " << t << ": " << setprecision(0) << stats.paresPorDistancia[t] << "\n";
+        }
+        cout << "\n";
+    }
 }
 
 void Estatisticas::salvarRelatorio(const string& nomeArquivo) const {
@@ -136,6 +275,12 @@ void Estatisticas::salvarRelatorio(const string& nomeArquivo) const {
     arquivo << "Grau máximo: " << stats.grauMaximo << "\n";
     arquivo << "Grau médio: " << fixed << setprecision(2) << stats.grauMedio << "\n";
     arquivo << "Mediana de grau: " << fixed << setprecision(1) << stats.medianaGrau << "\n";
+    arquivo << "Distribuição dos graus:\n";
+    for (size_t g = 0; g < stats.histogramaGraus.size(); g++) {
+        if (stats.histogramaGraus[g] > 0) {
+            arquivo << "  " << g << ": " << stats.histogramaGraus[g] << " vértices\n";
+        }
+    }
     arquivo << "\n";
 
     arquivo << "COMPONENTES CONEXAS:\n";
@@ -169,6 +314,75 @@ void Estatisticas::salvarRelatorio(const string& nomeArquivo) const {
                     << " e " << stats.verticesDiametro.second << "\n";
         }
     }
+    arquivo << "\n";
+
+    arquivo << "EXCENTRICIDADES:\n";
+    arquivo << "----------------\n";
+    if (!stats.isConexo) {
+        arquivo << "(raio e centro da maior componente)\n";
+    }
+    arquivo << "Raio: " << stats.raio << "\n";
+    arquivo << "Centro (" << stats.centro.size() << " vértices):";
+    for (int v : stats.centro) {
+        arquivo << " " << v;
+    }
+    arquivo << "\n";
+    arquivo << "Distribuição das excentricidades:\n";
+    for (size_t e = 0; e < stats.histogramaExcentricidades.size(); e++) {
+        if (stats.histogramaExcentricidades[e] > 0) {
+            arquivo << "  " << e << ": " << stats.histogramaExcentricidades[e] << " vértices\n";
+        }
+    }
+    arquivo << "BFS executadas: " << stats.buscasExcentricidades << "\n";
+
+    if (stats.temTriangulos) {
+        arquivo << "\n";
+        arquivo << "TRIÂNGULOS E AGRUPAMENTO:\n";
+        arquivo << "-------------------------\n";
+        arquivo << "Triângulos: " << stats.numTriangulos << "\n";
+        arquivo << "Coeficiente de agrupamento médio: " << fixed << setprecision(4)
+                << stats.coeficienteAgrupamentoMedio << "\n";
+        arquivo << "Transitividade (global): " << stats.transitividade << "\n";
+        arquivo << "Por vértice (triângulos, coeficiente local):\n";
+        for (size_t v = 0; v < stats.coeficientesAgrupamento.size(); v++) {
+            arquivo << "  " << (v + 1) << ": " << stats.triangulosPorVertice[v]
+                    << ", " << stats.coeficientesAgrupamento[v] << "\n";
+        }
+    }
+
+    if (stats.temNucleos) {
+        arquivo << "\n";
+        arquivo << "K-NÚCLEOS:\n";
+        arquivo << "----------\n";
+        arquivo << "Degeneração: " << stats.degeneracao << "\n";
+        arquivo << "Distribuição (núcleo: vértices, tamanho do k-núcleo):\n";
+        for (size_t k = 0; k < stats.verticesPorNucleo.size(); k++) {
+            arquivo << "  " << k << ": " << stats.verticesPorNucleo[k]
+                    << ", " << stats.tamanhosKNucleos[k] << "\n";
+        }
+        arquivo << "Núcleo por vértice:\n";
+        for (size_t v = 0; v < stats.nucleos.size(); v++) {
+            arquivo << "  " << (v + 1) << ": " << stats.nucleos[v] << "\n";
+        }
+    }
+
+    if (stats.temDistribuicaoAproximada) {
+        arquivo << "\n";
+        arquivo << "DISTRIBUIÇÃO DE DISTÂNCIAS (HyperANF, ESTIMADA):\n";
+        arquivo << "-----------------------------------------------\n";
+        arquivo << "Registradores por contador: " << stats.registradoresHyperANF << "\n";
+        arquivo << "Repetições: " << stats.repeticoesHyperANF << "\n";
+        arquivo << "Pares conectados: " << fixed << setprecision(0) << stats.paresAlcancaveis
+                << " (desvio relativo <= " << setprecision(1) << 100.0 * stats.erroRelativoPares << "%)\n";
+        arquivo << "Distância média: " << setprecision(3) << stats.distanciaMedia
+                << " ± " << stats.desvioDistanciaMedia << "\n";
+        arquivo << "Diâmetro efetivo (90%): " << stats.diametroEfetivo
+                << " ± " << stats.desvioDiametroEfetivo << "\n";
+        arquivo << "Pares por distância:\n";
+        for (size_t t = 1; t < stats.paresPorDistancia.size(); t++) {
+            arquivo << "  " << t << ": " << setprecision(0) << stats.paresPorDistancia[t] << "\n";
+        }
+    }
 }
 
 
@@ -182,8 +396,7 @@ vector<int> Estatisticas::calcularGraus(const IGrafo& grafo) {
     vector<int> graus(n, 0);
 
     for (int i = 0; i < n; i++) {
-        vector<int> vizinhos = grafo.getVizinhos(i);
-        graus[i] = vizinhos.size();
+        graus[i] = grafo.getGrau(i);
     }
 
     return graus;
@@ -193,99 +406,69 @@ void Estatisticas::calcularEstatisticas(const IGrafo& grafo, int numArestas) {
     stats.numArestas = numArestas;
     vector<int> graus = calcularGraus(grafo);
     calcularEstatisticasGrau(graus);
-    calcularDiametro(grafo);
+    calcularExcentricidades(grafo);
 }
 
-void Estatisticas::calcularDiametro(const IGrafo& grafo) {
-    Distancias dist(n);
-
-    if (n > 100) {
-        cout << "🚀 Usando algoritmo otimizado para cálculo do diâmetro\n";
-        // Para grafos grandes, usamos a implementação específica mais eficiente
-        // Convertemos para ListaAdjacencia temporariamente
-        // Isso poderia ser melhorado criando uma versão genérica do algoritmo otimizado
-        cout << "⚠️  Algoritmo otimizado requer conversão para implementação específica\n";
-        // dist.calcularDiametroApenas(grafo); // TODO: implementar versão genérica
-    } else {
-        dist.calcularDistancias(grafo);
-    }
-
-    stats.diametro = dist.getDiametro();
-    stats.verticesDiametro = dist.getVerticesDiametro();
+// O diâmetro sai das mesmas BFS que fecham as excentricidades
+void Estatisticas::calcularExcentricidades(const IGrafo& grafo) {
+    Excentricidades excentricidades(n);
+    excentricidades.calcular(grafo);
+
+    stats.diametro = excentricidades.getDiametro();
+    stats.verticesDiametro = excentricidades.getVerticesDiametro();
+    stats.raio = excentricidades.getRaio();
+    stats.centro = excentricidades.getCentro();
+    stats.histogramaExcentricidades = excentricidades.getHistograma();
+    stats.buscasExcentricidades = excentricidades.getNumBuscas();
 }
 
-void Estatisticas::analisarBuscas(const IGrafo& grafo) {
+void Estatisticas::analisarBuscas(const AgendadorAnalise& agenda) {
     cout << "\n🔍 ANÁLISE DE BUSCAS (BFS e DFS)\n";
     cout << "=================================\n";
 
-    vector<int> vertices_iniciais = {0, 1, 2}; // Usando base 0
-    vector<int> vertices_consulta = {9, 19, 29}; // Ajustado para base 0
-
-    for (int inicio : vertices_iniciais) {
-        if (inicio >= n) continue;
+    for (int inicio : VERTICES_INICIAIS) {
+        if (inicio > n) continue;
 
-        cout << "\n--- Iniciando busca a partir do vértice " << (inicio + 1) << " ---\n";
-
-        BFS bfs(n);
-        bfs.executarBFS(grafo, inicio + 1); // Convertendo para base 1 para BFS
-
-        vector<int> ordem_bfs = bfs.getOrdemVisitacao();
-        vector<int> distancias_bfs = bfs.getNiveis();
+        cout << "\n--- Iniciando busca a partir do vértice " << inicio << " ---\n";
 
+        const vector<int>& ordem_bfs = agenda.getOrdemBFS(inicio);
         cout << "🔵 BFS - Primeiros vértices visitados: ";
         for (int i = 0; i < min(10, (int)ordem_bfs.size()); i++) {
             cout << ordem_bfs[i] << " ";
         }
         cout << "\n";
 
-        DFS dfs(n);
-        dfs.executarDFS(grafo, inicio + 1); // Convertendo para base 1 para DFS
-
-        vector<int> ordem_dfs = dfs.getOrdemVisitacao();
-
+        const vector<int>& ordem_dfs = agenda.getOrdemDFS(inicio);
         cout << "🔴 DFS - Primeiros vértices visitados: ";
         for (int i = 0; i < min(10, (int)ordem_dfs.size()); i++) {
             cout << ordem_dfs[i] << " ";
         }
         cout << "\n";
 
-        for (int consulta : vertices_consulta) {
-            if (consulta >= n) continue;
+        for (int consulta : VERTICES_CONSULTA) {
+            if (consulta > n) continue;
 
-            int distancia = distancias_bfs[consulta];
+            int distancia = agenda.getDistancia(inicio, consulta);
             if (distancia >= 0) { // Verifica se o vértice foi alcançado
-                cout << "📏 Distância de " << (inicio + 1) << " até " << (consulta + 1) 
+                cout << "📏 Distância de " << inicio << " até " << consulta
                      << ": " << distancia << "\n";
             }
         }
     }
 }
 
-void Estatisticas::calcularDistanciasEspecificas(const IGrafo& grafo) {
+void Estatisticas::calcularDistanciasEspecificas(const AgendadorAnalise& agenda) {
     cout << "\n📐 ANÁLISE DE DISTÂNCIAS ESPECÍFICAS\n";
     cout << "=====================================\n";
 
-    vector<pair<int, int>> pares_vertices = {
-        {1, n/2}, {1, n-1}, {n/4, 3*n/4}
-    };
-
-    for (auto& par : pares_vertices) {
-        int origem = par.first - 1; // Converter para base 0
-        int destino = par.second - 1; // Converter para base 0
-        
-        if (origem >= n || destino >= n) continue;
-
-        BFS bfs(n);
-        bfs.executarBFS(grafo, origem + 1); // Converter de volta para base 1 para BFS
-
-        vector<int> distancias = bfs.getNiveis();
-        int distancia = distancias[destino];
+    for (const auto& [origem, destino] : paresEspecificos(n)) {
+        int distancia = agenda.getDistancia(origem, destino);
 
         if (distancia >= 0) { // Verifica se o vértice foi alcançado
-            cout << "🎯 Distância entre " << (origem + 1) << " e " << (destino + 1) 
+            cout << "🎯 Distância entre " << origem << " e " << destino
                  << ": " << distancia << "\n";
         } else {
-            cout << "❌ Vértices " << (origem + 1) << " e " << (destino + 1) 
+            cout << "❌ Vértices " << origem << " e " << destino
                  << " não estão conectados\n";
         }
     }
@@ -295,6 +478,36 @@ void Estatisticas::executarAnaliseCompleta(const IGrafo& grafo) {
     cout << "\n🔍 EXECUTANDO ANÁLISE COMPLETA DO GRAFO\n";
     cout << "========================================\n";
 
-    analisarBuscas(grafo);
-    calcularDistanciasEspecificas(grafo);
+    // Registra tudo o que as seções abaixo vão ler antes de percorrer o grafo
+    AgendadorAnalise agenda(n);
+    agenda.solicitarGraus();
+    for (int inicio : VERTICES_INICIAIS) {
+        if (inicio > n) continue;
+        agenda.solicitarOrdemBFS(inicio);
+        agenda.solicitarOrdemDFS(inicio);
+        for (int consulta : VERTICES_CONSULTA) {
+            if (consulta <= n) agenda.solicitarDistancia(inicio, consulta);
+        }
+    }
+    for (const auto& [origem, destino] : paresEspecificos(n)) {
+        agenda.solicitarDistancia(origem, destino);
+    }
+    agenda.executar(grafo);
+
+    if (n > 0) {
+        calcularEstatisticasGrau(agenda.getGraus());
+    }
+    analisarBuscas(agenda);
+    calcularDistanciasEspecificas(agenda);
+
+    cout << "\n⏱️  TEMPO POR FASE\n";
+    cout << "=================\n";
+    double total = 0.0;
+    for (const auto& [fase, ms] : agenda.getTemposFases()) {
+        cout << "• " << fase << ": " << fixed << setprecision(3) << ms << " ms\n";
+        total += ms;
+    }
+    cout << "• Total: " << total << " ms (" << agenda.getNumBFS() << " BFS e "
+         << agenda.getNumDFS() << " DFS; sem compartilhar seriam "
+         << agenda.getNumBFSSemAgendamento() << " BFS)\n";
 }
@@ -9,6 +9,11 @@
 #include "../representacao_leitura/lista_adjacencia.h"
 #include "componentes.h"
 #include "distancias.h"
+#include "excentricidades.h"
+#include "hyperanf.h"
+#include "triangulos.h"
+#include "decomposicao_nucleos.h"
+#include "agendador_analise.h"
 #include "../busca/bfs.h"
 #include "../busca/dfs.h"
 
@@ -25,11 +30,44 @@ struct EstatisticasGrafo {
     vector<int> tamanhosComponentes;
     bool isConexo;
     vector<int> graus;
+    vector<int> histogramaGraus;             // [g] = vértices com grau g
 
     int maiorComponente;
     int menorComponente;
     int diametro;
     pair<int, int> verticesDiametro;
+
+    int raio;                                // da maior componente
+    vector<int> centro;                      // base 1
+    vector<int> histogramaExcentricidades;   // [e] = vértices com excentricidade e
+    int buscasExcentricidades;               // BFS usadas no cálculo
+
+    // Estimativas do HyperANF (só preenchidas por adicionarDistribuicaoDistancias)
+    bool temDistribuicaoAproximada;
+    vector<double> paresPorDistancia;        // [t] = pares a distância t
+    double paresAlcancaveis;
+    double distanciaMedia;
+    double desvioDistanciaMedia;
+    double diametroEfetivo;
+    double desvioDiametroEfetivo;
+    double erroRelativoPares;                // desvio relativo máximo de cada contagem
+    int registradoresHyperANF;
+    int repeticoesHyperANF;
+
+    // Preenchidos por adicionarTriangulos
+    bool temTriangulos;
+    long long numTriangulos;
+    vector<long long> triangulosPorVertice;
+    vector<double> coeficientesAgrupamento;  // coeficiente local por vértice
+    double coeficienteAgrupamentoMedio;
+    double transitividade;
+
+    // Preenchidos por adicionarNucleos
+    bool temNucleos;
+    vector<int> nucleos;                     // núcleo de cada vértice
+    int degeneracao;                         // maior k com k-núcleo não vazio
+    vector<int> verticesPorNucleo;           // [k] = vértices com núcleo exatamente k
+    vector<int> tamanhosKNucleos;            // [k] = vértices com núcleo >= k
 };
 
 class Estatisticas {
@@ -39,13 +77,13 @@ private:
 
     // Métodos genéricos usando interface IGrafo
     vector<int> calcularGraus(const IGrafo& grafo);
-    void calcularDiametro(const IGrafo& grafo);
-    void analisarBuscas(const IGrafo& grafo);
-    void calcularDistanciasEspecificas(const IGrafo& grafo);
+    void calcularExcentricidades(const IGrafo& grafo);
+    void analisarBuscas(const AgendadorAnalise& agenda);
+    void calcularDistanciasEspecificas(const AgendadorAnalise& agenda);
 
     // Métodos auxiliares
     void calcularEstatisticasGrau(const vector<int>& graus);
-    double calcularMediana(const vector<int>& graus);
+    double calcularMediana(const vector<int>& histograma, int total);
 
 public:
     Estatisticas(int numVertices);
@@ -55,6 +93,9 @@ public:
     void executarAnaliseCompleta(const IGrafo& grafo);
 
     void adicionarInformacoesComponentes(const ComponentesConexas& componentes);
+    void adicionarDistribuicaoDistancias(const HyperANF& hyperANF);
+    void adicionarTriangulos(const ContagemTriangulos& triangulos);
+    void adicionarNucleos(const DecomposicaoNucleos& decomposicao);
 
     void imprimirEstatisticas() const;
     void salvarRelatorio(const string& nomeArquivo) const;
@@ -0,0 +1,159 @@
+#include "excentricidades.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+Excentricidades::Excentricidades(int numVertices) : n(numVertices) {
+    raio = 0;
+    diametro = 0;
+    verticesDiametro = {-1, -1};
+    numBuscas = 0;
+}
+
+int Excentricidades::bfs(const IGrafo& grafo, int origem, vector<int>& dist, vector<int>& fila) const {
+    fila.clear();
+    fila.push_back(origem);
+    dist[origem] = 0;
+
+    for (size_t i = 0; i < fila.size(); i++) {
+        int atual = fila[i];
+        for (int vizinho : grafo.getVizinhos(atual)) {
+            if (dist[vizinho] == -1) {
+                dist[vizinho] = dist[atual] + 1;
+                fila.push_back(vizinho);
+            }
+        }
+    }
+
+    return dist[fila.back()];
+}
+
+void Excentricidades::calcular(const IGrafo& grafo) {
+    excentricidade.assign(n, -1);
+    histograma.clear();
+    centro.clear();
+    raio = 0;
+    diametro = 0;
+    verticesDiametro = {-1, -1};
+    numBuscas = 0;
+    int maiorBusca = -1;
+
+    vector<int> dist(n, -1);
+    vector<int> fila;
+    vector<int> inferior(n, 0);
+    vector<int> superior(n, numeric_limits<int>::max());
+    vector<int> grau(n, 0);
+    size_t maiorComponente = 0;
+
+    for (int s = 0; s < n; s++) {
+        if (excentricidade[s] != -1) continue;
+
+        vector<int> candidatos;
+        int v = s;
+        bool menorInferior = true;
+
+        while (true) {
+            int e = bfs(grafo, v, dist, fila);
+            numBuscas++;
+            if (e > maiorBusca) {
+                maiorBusca = e;
+                verticesDiametro = {v + 1, fila.back() + 1};
+            }
+
+            // A primeira BFS da componente também revela seus vértices
+            if (candidatos.empty()) {
+                candidatos = fila;
+                for (int w : candidatos) {
+                    grau[w] = grafo.getGrau(w);
+                }
+            }
+
+            for (size_t i = 0; i < candidatos.size();) {
+                int w = candidatos[i];
+                int d = dist[w];
+                inferior[w] = max(inferior[w], max(e - d, d));
+                superior[w] = min(superior[w], e + d);
+                if (inferior[w] == superior[w]) {
+                    excentricidade[w] = inferior[w];
+                    candidatos[i] = candidatos.back();
+                    candidatos.pop_back();
+                } else {
+                    i++;
+                }
+            }
+
+            if (candidatos.empty()) break;
+
+            for (int w : fila) dist[w] = -1;
+
+            // Alterna entre o menor limite inferior (candidato a centro) e o
+            // maior limite superior (candidato à periferia)
+            v = candidatos.front();
+            for (int w : candidatos) {
+                bool melhor = menorInferior
+                    ? inferior[w] < inferior[v] || (inferior[w] == inferior[v] && grau[w] > grau[v])
+                    : superior[w] > superior[v] || (superior[w] == superior[v] && grau[w] > grau[v]);
+                if (melhor) v = w;
+            }
+            menorInferior = !menorInferior;
+        }
+
+        // fila ainda tem a componente inteira (a última BFS partiu dela)
+        for (int w : fila) dist[w] = -1;
+
+        int minimo = numeric_limits<int>::max();
+        for (int w : fila) {
+            minimo = min(minimo, excentricidade[w]);
+            diametro = max(diametro, excentricidade[w]);
+        }
+        if (fila.size() > maiorComponente) {
+            maiorComponente = fila.size();
+            raio = minimo;
+            centro.clear();
+            for (int w : fila) {
+                if (excentricidade[w] == minimo) centro.push_back(w + 1);
+            }
+            sort(centro.begin(), centro.end());
+        }
+    }
+
+    histograma.assign(diametro + 1, 0);
+    for (int e : excentricidade) {
+        histograma[e]++;
+    }
+}
+
+int Excentricidades::getExcentricidade(int vertice) const {
+    if (vertice < 1 || vertice > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+    return excentricidade[vertice - 1];
+}
+
+const vector<int>& Excentricidades::getExcentricidades() const {
+    return excentricidade;
+}
+
+const vector<int>& Excentricidades::getHistograma() const {
+    return histograma;
+}
+
+int Excentricidades::getRaio() const {
+    return raio;
+}
+
+int Excentricidades::getDiametro() const {
+    return diametro;
+}
+
+pair<int, int> Excentricidades::getVerticesDiametro() const {
+    return verticesDiametro;
+}
+
+const vector<int>& Excentricidades::getCentro() const {
+    return centro;
+}
+
+int Excentricidades::getNumBuscas() const {
+    return numBuscas;
+}
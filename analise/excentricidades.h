@@ -0,0 +1,58 @@
+#ifndef EXCENTRICIDADES_H
+#define EXCENTRICIDADES_H
+
+#include <vector>
+#include "../representacao_leitura/grafo_interface.h"
+using namespace std;
+
+// Excentricidades exatas de todos os vértices pelo BoundingDiameters de
+// Takes e Kosters (2011), componente a componente. Cada BFS a partir de v
+// dá, para todo w da componente,
+//     max(ecc(v) - d(v,w), d(v,w)) <= ecc(w) <= ecc(v) + d(v,w);
+// vértices cujos limites se encontram saem da lista de candidatos. A próxima
+// origem alterna entre o menor limite inferior e o maior limite superior
+// (empate: maior grau), o que costuma fechar tudo com poucas BFS.
+// A excentricidade de cada vértice é medida dentro da sua componente; raio e
+// centro se referem à maior componente (o grafo todo, se for conexo).
+// O vértice de excentricidade máxima só recebe esse valor por uma BFS cuja
+// origem tem a mesma excentricidade, então a maior BFS já dá o diâmetro
+// (maior distância finita) e um par de vértices que o realiza.
+class Excentricidades {
+private:
+    int n;
+    vector<int> excentricidade;  // por vértice em base 0
+    vector<int> histograma;      // histograma[e] = vértices com excentricidade e
+    int raio;
+    int diametro;
+    pair<int, int> verticesDiametro; // base 1; (-1, -1) sem vértices
+    vector<int> centro;          // base 1, em ordem crescente
+    int numBuscas;
+
+    // BFS restrita à componente da origem (base 0); dist chega em -1 e é
+    // restaurado pelo chamador a partir de fila
+    int bfs(const IGrafo& grafo, int origem, vector<int>& dist, vector<int>& fila) const;
+
+public:
+    Excentricidades(int numVertices);
+
+    void calcular(const IGrafo& grafo);
+
+    // Vértice em base 1
+    int getExcentricidade(int vertice) const;
+
+    const vector<int>& getExcentricidades() const;
+
+    const vector<int>& getHistograma() const;
+
+    int getRaio() const;
+
+    int getDiametro() const;
+
+    pair<int, int> getVerticesDiametro() const;
+
+    const vector<int>& getCentro() const;
+
+    int getNumBuscas() const;
+};
+
+#endif
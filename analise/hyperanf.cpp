@@ -0,0 +1,292 @@
+#include "hyperanf.h"
+#include "../busca/execucao_paralela.h"
+#include "../busca/operacoes_simd.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+const int TAMANHO_LOTE = 1024;
+const double FRACAO_DIAMETRO_EFETIVO = 0.9;
+const int MAIOR_POSTO = 64;
+
+// POTENCIAS_INVERSAS.valor[r] = 2^-r, para não chamar ldexp por registrador
+struct TabelaPotencias {
+    double valor[MAIOR_POSTO + 1];
+    TabelaPotencias() {
+        for (int r = 0; r <= MAIOR_POSTO; r++) {
+            valor[r] = ldexp(1.0, -r);
+        }
+    }
+};
+const TabelaPotencias POTENCIAS_INVERSAS;
+
+// splitmix64: espalha bem até índices consecutivos
+unsigned long long misturar(unsigned long long x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Distância média e diâmetro efetivo a partir de N(t), ignorando os pares (v, v)
+pair<double, double> medidasDerivadas(const vector<double>& N) {
+    double base = N[0];
+    double total = N.back() - base;
+    if (total <= 0.0) {
+        return {0.0, 0.0};
+    }
+
+    double soma = 0.0;
+    for (size_t t = 1; t < N.size(); t++) {
+        soma += t * (N[t] - N[t - 1]);
+    }
+
+    double alvo = FRACAO_DIAMETRO_EFETIVO * total;
+    double efetivo = N.size() - 1;
+    for (size_t t = 1; t < N.size(); t++) {
+        if (N[t] - base >= alvo) {
+            double anterior = N[t - 1] - base;
+            double passo = N[t] - N[t - 1];
+            efetivo = (t - 1) + (passo > 0.0 ? (alvo - anterior) / passo : 1.0);
+            break;
+        }
+    }
+    return {soma / total, efetivo};
+}
+
+double desvioAmostral(const vector<double>& valores, double media) {
+    if (valores.size() < 2) return 0.0;
+    double soma = 0.0;
+    for (double v : valores) {
+        soma += (v - media) * (v - media);
+    }
+    return sqrt(soma / (valores.size() - 1));
+}
+} // namespace
+
+HyperANF::HyperANF(int precisao, int numThreads, int repeticoes) {
+    if (precisao < PRECISAO_MINIMA || precisao > PRECISAO_MAXIMA) {
+        throw invalid_argument("Precisão do HyperANF deve estar entre " + to_string(PRECISAO_MINIMA) +
+                               " e " + to_string(PRECISAO_MAXIMA));
+    }
+    if (repeticoes < 1) {
+        throw invalid_argument("Número de repetições deve ser positivo");
+    }
+    this->precisao = precisao;
+    this->numRegistradores = 1 << precisao;
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    this->repeticoes = repeticoes;
+    n = 0;
+    distanciaMedia = 0.0;
+    desvioDistanciaMedia = 0.0;
+    diametroEfetivo = 0.0;
+    desvioDiametroEfetivo = 0.0;
+    numIteracoes = 0;
+    tempoMs = 0.0;
+}
+
+double HyperANF::estimar(const uint8_t* contador) const {
+    double m = numRegistradores;
+    double alfa;
+    switch (numRegistradores) {
+        case 16: alfa = 0.673; break;
+        case 32: alfa = 0.697; break;
+        case 64: alfa = 0.709; break;
+        default: alfa = 0.7213 / (1.0 + 1.079 / m); break;
+    }
+
+    double soma = 0.0;
+    int zeros = 0;
+    for (int j = 0; j < numRegistradores; j++) {
+        soma += POTENCIAS_INVERSAS.valor[contador[j]];
+        if (contador[j] == 0) zeros++;
+    }
+
+    double estimativa = alfa * m * m / soma;
+    // Correção para cardinalidades pequenas (contagem linear)
+    if (estimativa <= 2.5 * m && zeros > 0) {
+        estimativa = m * log(m / zeros);
+    }
+    return estimativa;
+}
+
+vector<double> HyperANF::executar(const GrafoCSR& grafo, unsigned long long semente) const {
+    size_t m = numRegistradores;
+    vector<uint8_t> atual(static_cast<size_t>(n) * m, 0);
+    vector<uint8_t> proximo(static_cast<size_t>(n) * m);
+    vector<char> mudou(n, 1);
+    vector<char> proximoMudou(n);
+    vector<double> estimativa(n);
+
+    // Bola de raio 0: cada contador recebe só o próprio vértice
+    for (int v = 0; v < n; v++) {
+        unsigned long long h = misturar(v ^ semente);
+        size_t registrador = h >> (64 - precisao);
+        unsigned long long resto = h << precisao;
+        int posto = resto == 0 ? MAIOR_POSTO - precisao + 1 : __builtin_clzll(resto) + 1;
+        atual[v * m + registrador] = static_cast<uint8_t>(posto);
+    }
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int inicio, int fim, int) {
+        for (int v = inicio; v < fim; v++) {
+            estimativa[v] = estimar(&atual[v * m]);
+        }
+    });
+
+    vector<double> N;
+    N.push_back(n);
+
+    while (true) {
+        atomic<bool> algumMudou(false);
+        ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int inicio, int fim, int) {
+            bool localMudou = false;
+            for (int v = inicio; v < fim; v++) {
+                uint8_t* destino = &proximo[v * m];
+                const uint8_t* origem = &atual[v * m];
+                memcpy(destino, origem, m);
+
+                // Vizinhos que não mudaram já foram unidos a v na iteração anterior
+                const int* vizinhos = grafo.getVizinhos(v);
+                for (int i = 0; i < grafo.getGrau(v); i++) {
+                    int u = vizinhos[i];
+                    if (mudou[u]) {
+                        OperacoesSIMD::maximoBytes(destino, &atual[u * m], m);
+                    }
+                }
+
+                proximoMudou[v] = memcmp(destino, origem, m) != 0;
+                if (proximoMudou[v]) {
+                    estimativa[v] = estimar(destino);
+                    localMudou = true;
+                }
+            }
+            if (localMudou) algumMudou.store(true, memory_order_relaxed);
+        });
+
+        if (!algumMudou.load()) break;
+
+        swap(atual, proximo);
+        swap(mudou, proximoMudou);
+
+        double soma = 0.0;
+        for (double e : estimativa) {
+            soma += e;
+        }
+        // Os contadores só crescem; a troca de estimador pode oscilar um pouco
+        N.push_back(max(soma, N.back()));
+    }
+
+    return N;
+}
+
+void HyperANF::calcular(const GrafoCSR& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    n = grafo.getNumVertices();
+    funcaoVizinhanca.clear();
+    numIteracoes = 0;
+
+    vector<vector<double>> execucoes;
+    vector<double> medias, efetivos;
+    for (int r = 0; r < repeticoes; r++) {
+        vector<double> N = executar(grafo, misturar(0x484C4C ^ (r + 1)));
+        numIteracoes = max(numIteracoes, static_cast<int>(N.size()) - 1);
+
+        pair<double, double> medidas = medidasDerivadas(N);
+        medias.push_back(medidas.first);
+        efetivos.push_back(medidas.second);
+        execucoes.push_back(move(N));
+    }
+
+    // Execuções que pararam antes ficam constantes no último valor
+    funcaoVizinhanca.assign(numIteracoes + 1, 0.0);
+    for (const auto& N : execucoes) {
+        for (int t = 0; t <= numIteracoes; t++) {
+            funcaoVizinhanca[t] += N[min(t, static_cast<int>(N.size()) - 1)] / repeticoes;
+        }
+    }
+
+    distanciaMedia = 0.0;
+    diametroEfetivo = 0.0;
+    for (int r = 0; r < repeticoes; r++) {
+        distanciaMedia += medias[r] / repeticoes;
+        diametroEfetivo += efetivos[r] / repeticoes;
+    }
+    desvioDistanciaMedia = desvioAmostral(medias, distanciaMedia);
+    desvioDiametroEfetivo = desvioAmostral(efetivos, diametroEfetivo);
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+const vector<double>& HyperANF::getFuncaoVizinhanca() const {
+    return funcaoVizinhanca;
+}
+
+vector<double> HyperANF::getParesPorDistancia() const {
+    vector<double> pares(funcaoVizinhanca.size(), 0.0);
+    for (size_t t = 1; t < funcaoVizinhanca.size(); t++) {
+        pares[t] = (funcaoVizinhanca[t] - funcaoVizinhanca[t - 1]) / 2.0;
+    }
+    return pares;
+}
+
+double HyperANF::getParesAlcancaveis() const {
+    if (funcaoVizinhanca.empty()) return 0.0;
+    return (funcaoVizinhanca.back() - funcaoVizinhanca[0]) / 2.0;
+}
+
+double HyperANF::getDistanciaMedia() const {
+    return distanciaMedia;
+}
+
+double HyperANF::getDesvioDistanciaMedia() const {
+    return desvioDistanciaMedia;
+}
+
+double HyperANF::getDiametroEfetivo() const {
+    return diametroEfetivo;
+}
+
+double HyperANF::getDesvioDiametroEfetivo() const {
+    return desvioDiametroEfetivo;
+}
+
+int HyperANF::getNumIteracoes() const {
+    return numIteracoes;
+}
+
+double HyperANF::getErroRelativo() const {
+    return 1.04 / sqrt(static_cast<double>(numRegistradores));
+}
+
+int HyperANF::getPrecisao() const {
+    return precisao;
+}
+
+int HyperANF::getNumRegistradores() const {
+    return numRegistradores;
+}
+
+int HyperANF::getNumThreads() const {
+    return numThreads;
+}
+
+int HyperANF::getRepeticoes() const {
+    return repeticoes;
+}
+
+double HyperANF::getTempoMs() const {
+    return tempoMs;
+}
+
+size_t HyperANF::getMemoriaBytes() const {
+    return memoriaNecessaria(n, precisao);
+}
+
+size_t HyperANF::memoriaNecessaria(int numVertices, int precisao) {
+    return 2 * static_cast<size_t>(numVertices) * (static_cast<size_t>(1) << precisao);
+}
@@ -0,0 +1,93 @@
+#ifndef HYPERANF_H
+#define HYPERANF_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "../representacao_leitura/grafo_csr.h"
+using namespace std;
+
+// Distribuição de distâncias aproximada pelo HyperANF (Boldi, Rosa e Vigna,
+// 2011). Cada vértice guarda um contador HyperLogLog com 2^precisao
+// registradores de um byte; na iteração t o contador de v vira a união (máximo
+// registrador a registrador) do seu contador com os dos vizinhos, e passa a
+// estimar |B(v, t)|, a bola de raio t. A soma N(t) das estimativas conta os
+// pares (u, v) com d(u, v) <= t, e dela saem a distribuição de distâncias, a
+// distância média e o diâmetro efetivo. Só os vizinhos cujo contador mudou na
+// iteração anterior entram na união.
+// O desvio padrão relativo de cada N(t) fica abaixo de 1.04 / sqrt(2^precisao);
+// para as medidas derivadas, o cálculo é repetido com sementes diferentes e o
+// desvio amostral entre as repetições é informado.
+class HyperANF {
+public:
+    static constexpr int PRECISAO_MINIMA = 4;
+    static constexpr int PRECISAO_MAXIMA = 16;
+
+private:
+    int precisao;         // log2 do número de registradores por contador
+    int numRegistradores;
+    int numThreads;
+    int repeticoes;
+
+    int n;
+    vector<double> funcaoVizinhanca; // N(t), média das repetições
+    double distanciaMedia;
+    double desvioDistanciaMedia;
+    double diametroEfetivo;          // percentil 90, interpolado
+    double desvioDiametroEfetivo;
+    int numIteracoes;                // maior t em que algum contador mudou
+    double tempoMs;
+
+    // Uma execução completa; devolve N(t) para t = 0, 1, ...
+    vector<double> executar(const GrafoCSR& grafo, unsigned long long semente) const;
+
+    double estimar(const uint8_t* contador) const;
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    HyperANF(int precisao = 7, int numThreads = 0, int repeticoes = 3);
+
+    void calcular(const GrafoCSR& grafo);
+
+    // N(t): pares ordenados (u, v), incluindo u == v, com d(u, v) <= t
+    const vector<double>& getFuncaoVizinhanca() const;
+
+    // Pares não ordenados de vértices distintos a distância exatamente t
+    // (posição 0 vazia)
+    vector<double> getParesPorDistancia() const;
+
+    // Pares não ordenados de vértices distintos conectados
+    double getParesAlcancaveis() const;
+
+    double getDistanciaMedia() const;
+
+    double getDesvioDistanciaMedia() const;
+
+    double getDiametroEfetivo() const;
+
+    double getDesvioDiametroEfetivo() const;
+
+    // Limite inferior do diâmetro: contadores só param de mudar quando as bolas param de crescer
+    int getNumIteracoes() const;
+
+    // Limite do desvio padrão relativo de N(t)
+    double getErroRelativo() const;
+
+    int getPrecisao() const;
+
+    int getNumRegistradores() const;
+
+    int getNumThreads() const;
+
+    int getRepeticoes() const;
+
+    double getTempoMs() const;
+
+    // Dois conjuntos de contadores (atual e próximo)
+    size_t getMemoriaBytes() const;
+
+    // Memória dos contadores antes de construir: 2 * n * 2^precisao bytes
+    static size_t memoriaNecessaria(int numVertices, int precisao);
+};
+
+#endif
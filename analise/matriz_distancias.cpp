@@ -0,0 +1,341 @@
+#include "matriz_distancias.h"
+#include "../busca/execucao_paralela.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <limits>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+const char MAGICO_MATRIZ[4] = {'D', 'S', 'T', '1'};
+const size_t TAMANHO_CABECALHO = 16;
+
+struct MaiorDistancia {
+    int distancia = 0;
+    int origem = 0;
+    int destino = 0;
+};
+
+// Uma BFS por componente dá ecc(s) <= diâmetro da componente <= 2 ecc(s)
+int limiteDistancias(const GrafoCSR& grafo) {
+    int n = grafo.getNumVertices();
+    vector<int> dist(n, -1);
+    vector<int> fila;
+    int limite = 0;
+
+    for (int s = 0; s < n; s++) {
+        if (dist[s] != -1) continue;
+        fila.clear();
+        fila.push_back(s);
+        dist[s] = 0;
+        for (size_t i = 0; i < fila.size(); i++) {
+            int atual = fila[i];
+            const int* vizinhos = grafo.getVizinhos(atual);
+            for (int j = 0; j < grafo.getGrau(atual); j++) {
+                if (dist[vizinhos[j]] == -1) {
+                    dist[vizinhos[j]] = dist[atual] + 1;
+                    fila.push_back(vizinhos[j]);
+                }
+            }
+        }
+        limite = max(limite, 2 * dist[fila.back()]);
+    }
+    return limite;
+}
+
+void gravarTudo(int descritor, const char* dados, size_t tamanho, off_t posicao) {
+    while (tamanho > 0) {
+        ssize_t gravados = pwrite(descritor, dados, tamanho, posicao);
+        if (gravados <= 0) {
+            throw runtime_error("Erro ao gravar matriz de distâncias");
+        }
+        dados += gravados;
+        tamanho -= gravados;
+        posicao += gravados;
+    }
+}
+
+// Cada thread pega a próxima origem livre, roda a BFS e grava a linha
+template <typename T>
+MaiorDistancia gerarLinhas(const GrafoCSR& grafo, int descritor, int numThreads,
+                           const ProgressoMatriz& progresso) {
+    int n = grafo.getNumVertices();
+    const T SENTINELA = numeric_limits<T>::max();
+    int passoProgresso = max(1, n / 100);
+
+    atomic<int> proxima(0);
+    atomic<int> concluidas(0);
+    atomic<bool> falhou(false);
+    mutex travaProgresso;
+    vector<MaiorDistancia> maiores(numThreads);
+    string erro;
+
+    auto trabalhar = [&](int indice) {
+        vector<int> dist(n, -1);
+        vector<int> fila;
+        vector<T> linha(n, SENTINELA);
+        MaiorDistancia& maior = maiores[indice];
+
+        try {
+            for (int origem = proxima.fetch_add(1); origem < n && !falhou.load(memory_order_relaxed);
+                 origem = proxima.fetch_add(1)) {
+                fila.clear();
+                fila.push_back(origem);
+                dist[origem] = 0;
+                for (size_t i = 0; i < fila.size(); i++) {
+                    int atual = fila[i];
+                    const int* vizinhos = grafo.getVizinhos(atual);
+                    for (int j = 0; j < grafo.getGrau(atual); j++) {
+                        if (dist[vizinhos[j]] == -1) {
+                            dist[vizinhos[j]] = dist[atual] + 1;
+                            fila.push_back(vizinhos[j]);
+                        }
+                    }
+                }
+
+                for (int v : fila) {
+                    linha[v] = static_cast<T>(dist[v]);
+                }
+                int ultimo = fila.back();
+                if (dist[ultimo] > maior.distancia) {
+                    maior = {dist[ultimo], origem + 1, ultimo + 1};
+                }
+
+                off_t posicao = TAMANHO_CABECALHO + static_cast<off_t>(origem) * n * sizeof(T);
+                gravarTudo(descritor, reinterpret_cast<const char*>(linha.data()), n * sizeof(T), posicao);
+
+                // Só os vértices da componente foram tocados
+                for (int v : fila) {
+                    linha[v] = SENTINELA;
+                    dist[v] = -1;
+                }
+
+                int feitas = concluidas.fetch_add(1) + 1;
+                if (progresso && (feitas % passoProgresso == 0 || feitas == n)) {
+                    lock_guard<mutex> trava(travaProgresso);
+                    progresso(feitas, n);
+                }
+            }
+        } catch (const exception& e) {
+            lock_guard<mutex> trava(travaProgresso);
+            if (!falhou.exchange(true)) erro = e.what();
+        }
+    };
+
+    vector<thread> trabalhadores;
+    for (int t = 1; t < numThreads; t++) {
+        trabalhadores.emplace_back(trabalhar, t);
+    }
+    trabalhar(0);
+    for (auto& t : trabalhadores) {
+        t.join();
+    }
+
+    if (falhou.load()) {
+        throw runtime_error(erro);
+    }
+
+    MaiorDistancia resultado;
+    for (const auto& m : maiores) {
+        if (m.distancia > resultado.distancia) resultado = m;
+    }
+    return resultado;
+}
+} // namespace
+
+MatrizDistancias::MatrizDistancias(int numThreads) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    bytesPorEntrada = 0;
+    tempoMs = 0.0;
+    bytesEscritos = 0;
+    memoriaTrabalhoBytes = 0;
+    maiorDistancia = 0;
+    verticesMaiorDistancia = {-1, -1};
+}
+
+void MatrizDistancias::gerar(const GrafoCSR& grafo, const string& nomeArquivo,
+                             const ProgressoMatriz& progresso) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    int n = grafo.getNumVertices();
+    int limite = limiteDistancias(grafo);
+    uint32_t sentinela;
+    if (limite < numeric_limits<uint8_t>::max()) {
+        bytesPorEntrada = 1;
+        sentinela = numeric_limits<uint8_t>::max();
+    } else if (limite < numeric_limits<uint16_t>::max()) {
+        bytesPorEntrada = 2;
+        sentinela = numeric_limits<uint16_t>::max();
+    } else {
+        bytesPorEntrada = 4;
+        sentinela = numeric_limits<uint32_t>::max();
+    }
+
+    size_t tamanho = tamanhoArquivo(n, bytesPorEntrada);
+    filesystem::path caminho = filesystem::absolute(nomeArquivo);
+    error_code codigo;
+    filesystem::space_info espaco = filesystem::space(caminho.parent_path(), codigo);
+    if (!codigo && espaco.available < tamanho) {
+        throw runtime_error("Espaço em disco insuficiente para a matriz de distâncias (" +
+                            to_string(tamanho / (1024 * 1024)) + " MB)");
+    }
+
+    int descritor = open(nomeArquivo.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0) {
+        throw runtime_error("Erro ao criar arquivo da matriz de distâncias");
+    }
+
+    int threads = max(1, min(numThreads, n));
+    MaiorDistancia maior;
+    try {
+        char cabecalho[TAMANHO_CABECALHO];
+        int32_t numVertices = n;
+        int32_t bytes = bytesPorEntrada;
+        memcpy(cabecalho, MAGICO_MATRIZ, 4);
+        memcpy(cabecalho + 4, &numVertices, 4);
+        memcpy(cabecalho + 8, &bytes, 4);
+        memcpy(cabecalho + 12, &sentinela, 4);
+        gravarTudo(descritor, cabecalho, TAMANHO_CABECALHO, 0);
+
+        if (n > 0) {
+            if (bytesPorEntrada == 1) {
+                maior = gerarLinhas<uint8_t>(grafo, descritor, threads, progresso);
+            } else if (bytesPorEntrada == 2) {
+                maior = gerarLinhas<uint16_t>(grafo, descritor, threads, progresso);
+            } else {
+                maior = gerarLinhas<uint32_t>(grafo, descritor, threads, progresso);
+            }
+        }
+    } catch (...) {
+        close(descritor);
+        throw;
+    }
+
+    if (close(descritor) != 0) {
+        throw runtime_error("Erro ao fechar arquivo da matriz de distâncias");
+    }
+
+    bytesEscritos = tamanho;
+    memoriaTrabalhoBytes = static_cast<size_t>(threads) * n * (2 * sizeof(int) + bytesPorEntrada);
+    maiorDistancia = maior.distancia;
+    if (n == 0) {
+        verticesMaiorDistancia = {-1, -1};
+    } else if (maior.distancia == 0) {
+        verticesMaiorDistancia = {1, 1}; // sem arestas, como em Distancias::calcularDistancias
+    } else {
+        verticesMaiorDistancia = {maior.origem, maior.destino};
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+vector<int> MatrizDistancias::lerLinha(const string& nomeArquivo, int origem) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        throw runtime_error("Erro ao abrir arquivo da matriz de distâncias");
+    }
+
+    char magico[4];
+    int32_t n = 0, bytes = 0;
+    uint32_t sentinela = 0;
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&n), sizeof(n));
+    arquivo.read(reinterpret_cast<char*>(&bytes), sizeof(bytes));
+    arquivo.read(reinterpret_cast<char*>(&sentinela), sizeof(sentinela));
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_MATRIZ) ||
+        (bytes != 1 && bytes != 2 && bytes != 4)) {
+        throw runtime_error("Arquivo da matriz de distâncias inválido");
+    }
+    if (origem < 1 || origem > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+
+    vector<char> bruto(static_cast<size_t>(n) * bytes);
+    arquivo.seekg(TAMANHO_CABECALHO + static_cast<size_t>(origem - 1) * n * bytes);
+    arquivo.read(bruto.data(), bruto.size());
+    if (!arquivo) {
+        throw runtime_error("Arquivo da matriz de distâncias incompleto");
+    }
+
+    vector<int> linha(n);
+    for (int v = 0; v < n; v++) {
+        uint32_t valor = 0;
+        if (bytes == 1) {
+            valor = reinterpret_cast<const uint8_t*>(bruto.data())[v];
+        } else if (bytes == 2) {
+            valor = reinterpret_cast<const uint16_t*>(bruto.data())[v];
+        } else {
+            valor = reinterpret_cast<const uint32_t*>(bruto.data())[v];
+        }
+        linha[v] = valor == sentinela ? -1 : static_cast<int>(valor);
+    }
+    return linha;
+}
+
+int MatrizDistancias::lerNumVertices(const string& nomeArquivo) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    char magico[4];
+    int32_t n = 0;
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_MATRIZ)) {
+        throw runtime_error("Arquivo da matriz de distâncias inválido");
+    }
+    return n;
+}
+
+size_t MatrizDistancias::tamanhoArquivo(int numVertices, int bytesPorEntrada) {
+    return TAMANHO_CABECALHO + static_cast<size_t>(numVertices) * numVertices * bytesPorEntrada;
+}
+
+int MatrizDistancias::getNumThreads() const {
+    return numThreads;
+}
+
+int MatrizDistancias::getBytesPorEntrada() const {
+    return bytesPorEntrada;
+}
+
+double MatrizDistancias::getTempoMs() const {
+    return tempoMs;
+}
+
+size_t MatrizDistancias::getBytesEscritos() const {
+    return bytesEscritos;
+}
+
+size_t MatrizDistancias::getMemoriaTrabalhoBytes() const {
+    return memoriaTrabalhoBytes;
+}
+
+int MatrizDistancias::getMaiorDistancia() const {
+    return maiorDistancia;
+}
+
+pair<int, int> MatrizDistancias::getVerticesMaiorDistancia() const {
+    return verticesMaiorDistancia;
+}
+
+long MatrizDistancias::lerPicoMemoriaKB() {
+    ifstream status("/proc/self/status");
+    string linha;
+    while (getline(status, linha)) {
+        if (linha.compare(0, 6, "VmHWM:") == 0) {
+            istringstream iss(linha.substr(6));
+            long memoria = -1;
+            iss >> memoria;
+            return memoria;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,67 @@
+#ifndef MATRIZ_DISTANCIAS_H
+#define MATRIZ_DISTANCIAS_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <functional>
+#include "../representacao_leitura/grafo_csr.h"
+using namespace std;
+
+// Recebe (origens concluídas, total); chamado de uma thread por vez
+typedef function<void(int, int)> ProgressoMatriz;
+
+// Matriz de distâncias completa (grafos sem peso) gravada direto em arquivo:
+// cada thread roda BFS a partir de uma origem por vez e grava a linha com
+// pwrite na sua posição, então a memória fica em O(threads * n), e não em
+// O(n^2). As entradas usam o menor tipo sem sinal que comporta o dobro da
+// maior excentricidade amostrada (um BFS por componente), com o valor máximo
+// do tipo como sentinela de "inalcançável".
+// Formato: "DST1", n (int32), bytes por entrada (int32), sentinela (uint32)
+// e as n linhas de n entradas, em ordem de origem.
+class MatrizDistancias {
+private:
+    int numThreads;
+    int bytesPorEntrada;
+    double tempoMs;
+    size_t bytesEscritos;
+    size_t memoriaTrabalhoBytes; // buffers das threads, sem contar o grafo
+    int maiorDistancia;
+    pair<int, int> verticesMaiorDistancia; // base 1
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    MatrizDistancias(int numThreads = 0);
+
+    // Lança runtime_error se o arquivo não puder ser criado ou não houver
+    // espaço em disco para ele
+    void gerar(const GrafoCSR& grafo, const string& nomeArquivo,
+               const ProgressoMatriz& progresso = nullptr);
+
+    // Linha da origem (base 1) em base 0, com -1 para inalcançável
+    static vector<int> lerLinha(const string& nomeArquivo, int origem);
+
+    static int lerNumVertices(const string& nomeArquivo);
+
+    static size_t tamanhoArquivo(int numVertices, int bytesPorEntrada);
+
+    int getNumThreads() const;
+
+    int getBytesPorEntrada() const;
+
+    double getTempoMs() const;
+
+    size_t getBytesEscritos() const;
+
+    size_t getMemoriaTrabalhoBytes() const;
+
+    // Maior distância finita e um par que a realiza
+    int getMaiorDistancia() const;
+
+    pair<int, int> getVerticesMaiorDistancia() const;
+
+    // Pico de memória residente do processo (VmHWM), em KB; -1 se indisponível
+    static long lerPicoMemoriaKB();
+};
+
+#endif
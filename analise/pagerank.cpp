@@ -0,0 +1,252 @@
+#include "pagerank.h"
+#include "../busca/execucao_paralela.h"
+#include <unordered_map>
+#include <deque>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+const int TAMANHO_LOTE = 1024;
+
+double somar(const vector<double>& parciais) {
+    double soma = 0.0;
+    for (double valor : parciais) {
+        soma += valor;
+    }
+    return soma;
+}
+} // namespace
+
+PageRank::PageRank(const IGrafo& grafo, int numThreads)
+    : n(grafo.getNumVertices()), comPeso(false), adjacencia(grafo) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    calcularPesoTotal();
+}
+
+PageRank::PageRank(const IGrafoPeso& grafo, int numThreads)
+    : n(grafo.getNumVertices()), comPeso(true), adjacencia(grafo) {
+    if (adjacencia.getMenorPeso() < 0) {
+        throw invalid_argument("PageRank exige pesos não negativos");
+    }
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    calcularPesoTotal();
+}
+
+void PageRank::calcularPesoTotal() {
+    const vector<long long>& inicio = adjacencia.getInicio();
+    const vector<double>& pesos = adjacencia.getPesos();
+    pesoTotal.assign(n, 0.0);
+    for (int v = 0; v < n; v++) {
+        if (!comPeso) {
+            pesoTotal[v] = inicio[v + 1] - inicio[v];
+            continue;
+        }
+        for (long long e = inicio[v]; e < inicio[v + 1]; e++) {
+            pesoTotal[v] += pesos[e];
+        }
+    }
+
+    numIteracoes = 0;
+    variacaoFinal = 0.0;
+    convergiu = false;
+    tempoMs = 0.0;
+    residuoPersonalizado = 0.0;
+    numEmpurroes = 0;
+    tempoPersonalizadoMs = 0.0;
+}
+
+void PageRank::calcular(double amortecimento, double tolerancia, int maxIteracoes) {
+    if (amortecimento <= 0.0 || amortecimento >= 1.0) {
+        throw invalid_argument("Fator de amortecimento deve estar em (0, 1)");
+    }
+    if (tolerancia <= 0.0 || maxIteracoes < 1) {
+        throw invalid_argument("Tolerância e número de iterações devem ser positivos");
+    }
+
+    auto tempoInicio = chrono::high_resolution_clock::now();
+    const vector<long long>& inicio = adjacencia.getInicio();
+    const vector<int>& vizinhos = adjacencia.getVizinhos();
+    const vector<double>& pesos = adjacencia.getPesos();
+
+    valores.assign(n, n > 0 ? 1.0 / n : 0.0);
+    vector<double> novos(n, 0.0);
+    vector<double> contribuicao(n, 0.0);
+    vector<double> parciais(numThreads, 0.0);
+    numIteracoes = 0;
+    convergiu = false;
+    variacaoFinal = 0.0;
+
+    while (n > 0 && numIteracoes < maxIteracoes) {
+        // Contribuição por unidade de peso e massa dos vértices sem saída
+        fill(parciais.begin(), parciais.end(), 0.0);
+        ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int idThread) {
+            double semSaida = 0.0;
+            for (int u = ini; u < fim; u++) {
+                if (pesoTotal[u] > 0.0) {
+                    contribuicao[u] = valores[u] / pesoTotal[u];
+                } else {
+                    contribuicao[u] = 0.0;
+                    semSaida += valores[u];
+                }
+            }
+            parciais[idThread] += semSaida;
+        });
+        double base = (1.0 - amortecimento + amortecimento * somar(parciais)) / n;
+
+        fill(parciais.begin(), parciais.end(), 0.0);
+        ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int idThread) {
+            double variacao = 0.0;
+            for (int v = ini; v < fim; v++) {
+                double soma = 0.0;
+                if (comPeso) {
+                    for (long long e = inicio[v]; e < inicio[v + 1]; e++) {
+                        soma += pesos[e] * contribuicao[vizinhos[e]];
+                    }
+                } else {
+                    for (long long e = inicio[v]; e < inicio[v + 1]; e++) {
+                        soma += contribuicao[vizinhos[e]];
+                    }
+                }
+                novos[v] = base + amortecimento * soma;
+                variacao += fabs(novos[v] - valores[v]);
+            }
+            parciais[idThread] += variacao;
+        });
+
+        valores.swap(novos);
+        numIteracoes++;
+        variacaoFinal = somar(parciais);
+        if (variacaoFinal < tolerancia) {
+            convergiu = true;
+            break;
+        }
+    }
+
+    auto tempoFim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(tempoFim - tempoInicio).count() / 1000.0;
+}
+
+void PageRank::calcularPersonalizado(int origem, double amortecimento, double epsilon) {
+    if (origem < 1 || origem > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+    if (amortecimento <= 0.0 || amortecimento >= 1.0) {
+        throw invalid_argument("Fator de amortecimento deve estar em (0, 1)");
+    }
+    if (epsilon <= 0.0) {
+        throw invalid_argument("Epsilon deve ser positivo");
+    }
+
+    auto tempoInicio = chrono::high_resolution_clock::now();
+    const vector<long long>& inicio = adjacencia.getInicio();
+    const vector<int>& vizinhos = adjacencia.getVizinhos();
+    const vector<double>& pesos = adjacencia.getPesos();
+
+    // Vértices sem vizinhos usam limiar epsilon, para não entrar na fila com resíduo nulo
+    auto limiar = [&](int v) {
+        return epsilon * (pesoTotal[v] > 0.0 ? pesoTotal[v] : 1.0);
+    };
+
+    // Estimativa e resíduo só dos vértices alcançados pelos empurrões
+    unordered_map<int, double> estimativa, residuo;
+    deque<int> fila;
+    int s = origem - 1;
+    residuo[s] = 1.0;
+    fila.push_back(s);
+    numEmpurroes = 0;
+
+    while (!fila.empty()) {
+        int u = fila.front();
+        fila.pop_front();
+        double ru = residuo[u];
+        if (ru < limiar(u)) continue;
+
+        numEmpurroes++;
+        residuo[u] = 0.0;
+        estimativa[u] += (1.0 - amortecimento) * ru;
+        if (pesoTotal[u] == 0.0) {
+            // Sem vizinhos, a caminhada recomeça na origem, como o salto do PageRank global
+            double& rs = residuo[s];
+            double antes = rs;
+            rs += amortecimento * ru;
+            if (antes < limiar(s) && rs >= limiar(s)) {
+                fila.push_back(s);
+            }
+            continue;
+        }
+
+        double porPeso = amortecimento * ru / pesoTotal[u];
+        for (long long e = inicio[u]; e < inicio[u + 1]; e++) {
+            int v = vizinhos[e];
+            double& rv = residuo[v];
+            double antes = rv;
+            rv += porPeso * (comPeso ? pesos[e] : 1.0);
+            // Entra na fila ao cruzar o limiar; quem já estava acima continua nela
+            if (antes < limiar(v) && rv >= limiar(v)) {
+                fila.push_back(v);
+            }
+        }
+    }
+
+    residuoPersonalizado = 0.0;
+    for (const auto& [v, r] : residuo) {
+        residuoPersonalizado += r;
+    }
+
+    personalizado.clear();
+    for (const auto& [v, valor] : estimativa) {
+        personalizado.push_back({v + 1, valor});
+    }
+    sort(personalizado.begin(), personalizado.end(), [](const pair<int, double>& a, const pair<int, double>& b) {
+        return a.second > b.second || (a.second == b.second && a.first < b.first);
+    });
+
+    auto tempoFim = chrono::high_resolution_clock::now();
+    tempoPersonalizadoMs = chrono::duration_cast<chrono::microseconds>(tempoFim - tempoInicio).count() / 1000.0;
+}
+
+const vector<double>& PageRank::getValores() const {
+    return valores;
+}
+
+int PageRank::getNumIteracoes() const {
+    return numIteracoes;
+}
+
+double PageRank::getVariacaoFinal() const {
+    return variacaoFinal;
+}
+
+bool PageRank::getConvergiu() const {
+    return convergiu;
+}
+
+double PageRank::getTempoMs() const {
+    return tempoMs;
+}
+
+double PageRank::getTempoPorIteracaoMs() const {
+    return numIteracoes > 0 ? tempoMs / numIteracoes : 0.0;
+}
+
+const vector<pair<int, double>>& PageRank::getPersonalizado() const {
+    return personalizado;
+}
+
+double PageRank::getResiduoPersonalizado() const {
+    return residuoPersonalizado;
+}
+
+long long PageRank::getNumEmpurroes() const {
+    return numEmpurroes;
+}
+
+double PageRank::getTempoPersonalizadoMs() const {
+    return tempoPersonalizadoMs;
+}
+
+int PageRank::getNumThreads() const {
+    return numThreads;
+}
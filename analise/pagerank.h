@@ -0,0 +1,82 @@
+#ifndef PAGERANK_H
+#define PAGERANK_H
+
+#include <vector>
+#include <utility>
+#include "../representacao_leitura/grafo_interface.h"
+#include "../representacao_leitura/grafo_peso_interface.h"
+#include "../representacao_leitura/grafo_simples.h"
+using namespace std;
+
+// PageRank de grafos não direcionados. Com peso, a probabilidade de ir de u
+// para v é peso(u, v) / soma dos pesos de u; sem peso, 1 / grau(u). Vértices
+// sem vizinhos (ou com soma de pesos zero) redistribuem sua massa igualmente.
+// O grafo é tratado como simples, igual nas estruturas de lista e de matriz:
+// laços são ignorados e arestas paralelas contam uma vez, com o menor peso.
+// - calcular: iteração de potência em modo "pull": cada vértice soma as
+//   contribuições pr(u) / W(u) dos seus vizinhos, lidas de um vetor calculado
+//   antes em paralelo, então nenhuma escrita é compartilhada. Os vértices são
+//   divididos em lotes entre as threads; para quando a variação L1 entre duas
+//   iterações fica abaixo da tolerância.
+// - calcularPersonalizado: aproximação local de Andersen, Chung e Lang (2006)
+//   com teleporte para a origem. Só empurra resíduo de vértices com
+//   resíduo(u) >= epsilon * W(u), então visita apenas a vizinhança da origem;
+//   o erro em cada v fica abaixo de epsilon * W(v) (epsilon se W(v) = 0).
+class PageRank {
+private:
+    int n;
+    bool comPeso;
+    int numThreads;
+
+    GrafoSimples adjacencia;
+    vector<double> pesoTotal; // W(v): grau ou soma dos pesos
+
+    vector<double> valores;
+    int numIteracoes;
+    double variacaoFinal;     // variação L1 da última iteração
+    bool convergiu;
+    double tempoMs;
+
+    vector<pair<int, double>> personalizado;
+    double residuoPersonalizado; // massa que ficou sem empurrar
+    long long numEmpurroes;
+    double tempoPersonalizadoMs;
+
+    void calcularPesoTotal();
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    PageRank(const IGrafo& grafo, int numThreads = 0);
+    PageRank(const IGrafoPeso& grafo, int numThreads = 0);
+
+    void calcular(double amortecimento = 0.85, double tolerancia = 1e-10, int maxIteracoes = 200);
+
+    // Origem em base 1
+    void calcularPersonalizado(int origem, double amortecimento = 0.85, double epsilon = 1e-7);
+
+    // Vetor em base 0, soma 1
+    const vector<double>& getValores() const;
+
+    int getNumIteracoes() const;
+
+    double getVariacaoFinal() const;
+
+    bool getConvergiu() const;
+
+    double getTempoMs() const;
+
+    double getTempoPorIteracaoMs() const;
+
+    // (vértice em base 1, valor) dos vértices tocados, em ordem decrescente
+    const vector<pair<int, double>>& getPersonalizado() const;
+
+    double getResiduoPersonalizado() const;
+
+    long long getNumEmpurroes() const;
+
+    double getTempoPersonalizadoMs() const;
+
+    int getNumThreads() const;
+};
+
+#endif
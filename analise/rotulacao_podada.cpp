@@ -0,0 +1,266 @@
+#include "rotulacao_podada.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+#include "../representacao_leitura/assinatura_grafo.h"
+
+namespace {
+const char MAGICO_PLL[4] = {'P', 'L', 'L', '2'};
+const uint16_t DIST_MAXIMA = 0xFFFF;
+} // namespace
+
+RotulacaoPodada::RotulacaoPodada(int numVertices) : n(numVertices) {
+    inicioRotulo.assign(n + 1, 0);
+    assinaturaGrafo = 0;
+    tempoConstrucaoMs = 0.0;
+}
+
+void RotulacaoPodada::construir(const IGrafo& grafo) {
+    if (grafo.getNumVertices() != n) {
+        throw invalid_argument("Número de vértices do grafo não corresponde ao índice");
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+    assinaturaGrafo = calcularAssinatura(grafo);
+
+    // Cópia da adjacência renumerada pela ordem de grau: as BFS podadas
+    // chamam getVizinhos muitas vezes e os adaptadores devolvem cópias
+    vector<vector<int>> adjacencia(n);
+    for (int v = 0; v < n; v++) {
+        adjacencia[v] = grafo.getVizinhos(v);
+    }
+
+    vector<int> ordem(n);
+    iota(ordem.begin(), ordem.end(), 0);
+    stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+        return adjacencia[a].size() > adjacencia[b].size();
+    });
+
+    vector<int> posicao(n);
+    for (int r = 0; r < n; r++) {
+        posicao[ordem[r]] = r;
+    }
+
+    vector<vector<int>> adjOrdenada(n);
+    for (int r = 0; r < n; r++) {
+        for (int w : adjacencia[ordem[r]]) {
+            adjOrdenada[r].push_back(posicao[w]);
+        }
+    }
+    adjacencia.clear();
+    adjacencia.shrink_to_fit();
+
+    // Rótulos indexados pela posição; como os marcos são processados em ordem
+    // crescente de posição, cada rótulo já sai ordenado pelo marco
+    vector<vector<int>> rotMarcos(n);
+    vector<vector<uint16_t>> rotDist(n);
+
+    vector<int> distRaiz(n, INFINITO);   // rótulo da raiz atual, indexado pelo marco
+    vector<int> distBusca(n, INFINITO);
+    vector<int> fila(n);
+
+    for (int raiz = 0; raiz < n; raiz++) {
+        for (size_t i = 0; i < rotMarcos[raiz].size(); i++) {
+            distRaiz[rotMarcos[raiz][i]] = rotDist[raiz][i];
+        }
+
+        int cabeca = 0, cauda = 0;
+        fila[cauda++] = raiz;
+        distBusca[raiz] = 0;
+
+        while (cabeca < cauda) {
+            int u = fila[cabeca++];
+            int d = distBusca[u];
+
+            // Poda: os marcos anteriores já cobrem d(raiz, u)
+            bool coberto = false;
+            const vector<int>& marcosU = rotMarcos[u];
+            const vector<uint16_t>& distU = rotDist[u];
+            for (size_t i = 0; i < marcosU.size(); i++) {
+                int dm = distRaiz[marcosU[i]];
+                if (dm != INFINITO && dm + distU[i] <= d) {
+                    coberto = true;
+                    break;
+                }
+            }
+            if (coberto) continue;
+
+            if (d >= DIST_MAXIMA) {
+                throw runtime_error("Erro ao construir índice: distância excede o limite do rótulo");
+            }
+            rotMarcos[u].push_back(raiz);
+            rotDist[u].push_back(d);
+
+            for (int w : adjOrdenada[u]) {
+                if (distBusca[w] == INFINITO) {
+                    distBusca[w] = d + 1;
+                    fila[cauda++] = w;
+                }
+            }
+        }
+
+        for (int i = 0; i < cauda; i++) {
+            distBusca[fila[i]] = INFINITO;
+        }
+        for (int m : rotMarcos[raiz]) {
+            distRaiz[m] = INFINITO;
+        }
+    }
+
+    // Compacta os rótulos em vetores contíguos, indexados pelo vértice original
+    inicioRotulo.assign(n + 1, 0);
+    for (int v = 0; v < n; v++) {
+        inicioRotulo[v + 1] = inicioRotulo[v] + rotMarcos[posicao[v]].size();
+    }
+
+    marcos.resize(inicioRotulo[n]);
+    distancias.resize(inicioRotulo[n]);
+    for (int v = 0; v < n; v++) {
+        int r = posicao[v];
+        copy(rotMarcos[r].begin(), rotMarcos[r].end(), marcos.begin() + inicioRotulo[v]);
+        copy(rotDist[r].begin(), rotDist[r].end(), distancias.begin() + inicioRotulo[v]);
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoConstrucaoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+int RotulacaoPodada::consultar(int origem, int destino) const {
+    if (origem < 1 || origem > n || destino < 1 || destino > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+
+    long long i = inicioRotulo[origem - 1], fimI = inicioRotulo[origem];
+    long long j = inicioRotulo[destino - 1], fimJ = inicioRotulo[destino];
+    int melhor = INFINITO;
+
+    // Interseção de dois rótulos ordenados pelo marco
+    while (i < fimI && j < fimJ) {
+        if (marcos[i] < marcos[j]) {
+            i++;
+        } else if (marcos[i] > marcos[j]) {
+            j++;
+        } else {
+            melhor = min(melhor, distancias[i] + distancias[j]);
+            i++;
+            j++;
+        }
+    }
+
+    return melhor;
+}
+
+void RotulacaoPodada::salvarEmArquivo(const string& nomeArquivo) const {
+    ofstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        throw runtime_error("Erro ao criar arquivo do índice de rótulos");
+    }
+
+    int32_t numVertices = n;
+    long long numEntradas = marcos.size();
+
+    arquivo.write(MAGICO_PLL, sizeof(MAGICO_PLL));
+    arquivo.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+    arquivo.write(reinterpret_cast<const char*>(&assinaturaGrafo), sizeof(assinaturaGrafo));
+    arquivo.write(reinterpret_cast<const char*>(&numEntradas), sizeof(numEntradas));
+    arquivo.write(reinterpret_cast<const char*>(inicioRotulo.data()), (n + 1) * sizeof(long long));
+    arquivo.write(reinterpret_cast<const char*>(marcos.data()), numEntradas * sizeof(int));
+    arquivo.write(reinterpret_cast<const char*>(distancias.data()), numEntradas * sizeof(uint16_t));
+
+    if (!arquivo) {
+        throw runtime_error("Erro ao gravar arquivo do índice de rótulos");
+    }
+}
+
+bool RotulacaoPodada::carregarDeArquivo(const string& nomeArquivo, const IGrafo& grafo) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        return false;
+    }
+
+    char magico[4];
+    int32_t numVertices = 0;
+    uint64_t assinatura = 0;
+    long long numEntradas = 0;
+
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&numVertices), sizeof(numVertices));
+    arquivo.read(reinterpret_cast<char*>(&assinatura), sizeof(assinatura));
+    arquivo.read(reinterpret_cast<char*>(&numEntradas), sizeof(numEntradas));
+
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_PLL) ||
+        numVertices != n || grafo.getNumVertices() != n || numEntradas < 0 ||
+        assinatura != calcularAssinatura(grafo)) {
+        return false;
+    }
+
+    vector<long long> novoInicio(n + 1);
+    arquivo.read(reinterpret_cast<char*>(novoInicio.data()), (n + 1) * sizeof(long long));
+    if (!arquivo || novoInicio[0] != 0 || novoInicio[n] != numEntradas) {
+        return false;
+    }
+    // Deslocamentos decrescentes fariam a consulta ler fora dos rótulos
+    for (int v = 0; v < n; v++) {
+        if (novoInicio[v + 1] < novoInicio[v]) {
+            return false;
+        }
+    }
+
+    vector<int> novosMarcos(numEntradas);
+    vector<uint16_t> novasDistancias(numEntradas);
+    arquivo.read(reinterpret_cast<char*>(novosMarcos.data()), numEntradas * sizeof(int));
+    arquivo.read(reinterpret_cast<char*>(novasDistancias.data()), numEntradas * sizeof(uint16_t));
+
+    if (!arquivo || static_cast<long long>(novosMarcos.size()) != novoInicio[n] ||
+        novosMarcos.size() != novasDistancias.size()) {
+        return false;
+    }
+
+    inicioRotulo = move(novoInicio);
+    marcos = move(novosMarcos);
+    distancias = move(novasDistancias);
+    assinaturaGrafo = assinatura;
+    tempoConstrucaoMs = 0.0;
+    return true;
+}
+
+string RotulacaoPodada::caminhoArquivoIndice(const string& caminhoGrafo) {
+    return caminhoGrafo + ".pll";
+}
+
+long long RotulacaoPodada::getNumEntradas() const {
+    return marcos.size();
+}
+
+double RotulacaoPodada::getTamanhoMedioRotulo() const {
+    return n > 0 ? static_cast<double>(marcos.size()) / n : 0.0;
+}
+
+size_t RotulacaoPodada::getMemoriaBytes() const {
+    return inicioRotulo.size() * sizeof(long long) +
+           marcos.size() * sizeof(int) +
+           distancias.size() * sizeof(uint16_t);
+}
+
+double RotulacaoPodada::getTempoConstrucaoMs() const {
+    return tempoConstrucaoMs;
+}
+
+void RotulacaoPodada::imprimirResumo() const {
+    size_t maiorRotulo = 0;
+    for (int v = 0; v < n; v++) {
+        maiorRotulo = max(maiorRotulo, static_cast<size_t>(inicioRotulo[v + 1] - inicioRotulo[v]));
+    }
+
+    cout << fixed << setprecision(3);
+    cout << "• Tempo de construção: " << tempoConstrucaoMs << " ms\n";
+    cout << "• Entradas nos rótulos: " << marcos.size() << "\n";
+    cout << setprecision(2);
+    cout << "• Tamanho médio do rótulo: " << getTamanhoMedioRotulo()
+         << " (maior: " << maiorRotulo << ")\n";
+    cout << "• Tamanho do índice: " << getMemoriaBytes() / (1024.0 * 1024.0) << " MB\n";
+}
@@ -0,0 +1,52 @@
+#ifndef ROTULACAO_PODADA_H
+#define ROTULACAO_PODADA_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "../representacao_leitura/grafo_interface.h"
+using namespace std;
+
+// Índice de rotulação por marcos podada (pruned landmark labeling, 2-hop).
+// Cada vértice guarda pares (marco, distância) ordenados pelo marco; a
+// distância entre u e v é o menor d(u, m) + d(m, v) entre os marcos comuns.
+// Os marcos são processados em ordem decrescente de grau, com BFS podada.
+class RotulacaoPodada {
+private:
+    int n;
+    vector<long long> inicioRotulo;  // rótulo de v em [inicioRotulo[v], inicioRotulo[v + 1])
+    vector<int> marcos;              // posição do marco na ordem de grau
+    vector<uint16_t> distancias;
+    uint64_t assinaturaGrafo;        // vértices e vizinhos; valida o arquivo salvo
+    double tempoConstrucaoMs;
+
+public:
+    static constexpr int INFINITO = 999999; // mesmo valor de Distancias::INFINITO
+
+    RotulacaoPodada(int numVertices);
+
+    void construir(const IGrafo& grafo);
+
+    // origem e destino em base 1; retorna INFINITO se não estiverem conectados
+    int consultar(int origem, int destino) const;
+
+    void salvarEmArquivo(const string& nomeArquivo) const;
+
+    // Retorna false se o arquivo não existir ou não corresponder ao grafo
+    bool carregarDeArquivo(const string& nomeArquivo, const IGrafo& grafo);
+
+    static string caminhoArquivoIndice(const string& caminhoGrafo);
+
+    long long getNumEntradas() const;
+
+    double getTamanhoMedioRotulo() const;
+
+    size_t getMemoriaBytes() const;
+
+    double getTempoConstrucaoMs() const;
+
+    void imprimirResumo() const;
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "triangulos.h"
+#include "../busca/execucao_paralela.h"
+#include "../busca/operacoes_simd.h"
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+
+namespace {
+const int TAMANHO_LOTE = 256;
+} // namespace
+
+ContagemTriangulos::ContagemTriangulos(int numThreads) {
+    this->numThreads = ExecucaoParalela::resolverNumThreads(numThreads);
+    numTriangulos = 0;
+    coeficienteMedio = 0.0;
+    transitividade = 0.0;
+    tempoMs = 0.0;
+}
+
+void ContagemTriangulos::calcular(const GrafoCSR& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    int n = grafo.getNumVertices();
+
+    // Vizinhanças sem laços nem repetições
+    vector<vector<int>> vizinhancas(n);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+        for (int v = ini; v < fim; v++) {
+            const int* vizinhos = grafo.getVizinhos(v);
+            vector<int>& lista = vizinhancas[v];
+            lista.assign(vizinhos, vizinhos + grafo.getGrau(v));
+            sort(lista.begin(), lista.end());
+            lista.erase(unique(lista.begin(), lista.end()), lista.end());
+            lista.erase(remove(lista.begin(), lista.end(), v), lista.end());
+        }
+    });
+
+    // posto[v]: posição de v na ordem por grau
+    vector<int> ordem(n);
+    iota(ordem.begin(), ordem.end(), 0);
+    sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+        size_t ga = vizinhancas[a].size(), gb = vizinhancas[b].size();
+        return ga < gb || (ga == gb && a < b);
+    });
+    vector<int> posto(n);
+    for (int i = 0; i < n; i++) {
+        posto[ordem[i]] = i;
+    }
+
+    // Listas orientadas em CSR, indexadas e preenchidas por posto
+    vector<long long> inicioOrientado(n + 1, 0);
+    for (int v = 0; v < n; v++) {
+        long long saida = 0;
+        for (int u : vizinhancas[v]) {
+            if (posto[u] > posto[v]) saida++;
+        }
+        inicioOrientado[posto[v] + 1] = saida;
+    }
+    for (int i = 0; i < n; i++) {
+        inicioOrientado[i + 1] += inicioOrientado[i];
+    }
+    vector<int> orientados(inicioOrientado[n]);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int) {
+        for (int v = ini; v < fim; v++) {
+            int* destino = orientados.data() + inicioOrientado[posto[v]];
+            int k = 0;
+            for (int u : vizinhancas[v]) {
+                if (posto[u] > posto[v]) destino[k++] = posto[u];
+            }
+            sort(destino, destino + k);
+        }
+    });
+
+    vector<int> grau(n);
+    for (int v = 0; v < n; v++) {
+        grau[v] = vizinhancas[v].size();
+    }
+    vector<vector<int>>().swap(vizinhancas);
+
+    // Cada thread acumula triângulos por posto em seu próprio vetor
+    int threads = max(1, numThreads);
+    vector<vector<long long>> parciais(threads);
+    ExecucaoParalela::paraCadaLote(n, numThreads, TAMANHO_LOTE, [&](int ini, int fim, int idThread) {
+        vector<long long>& contagem = parciais[idThread];
+        if (contagem.empty()) contagem.assign(n, 0);
+        vector<int> comuns;
+
+        for (int p = ini; p < fim; p++) {
+            const int* listaP = orientados.data() + inicioOrientado[p];
+            int grauP = inicioOrientado[p + 1] - inicioOrientado[p];
+            for (int i = 0; i < grauP; i++) {
+                int q = listaP[i];
+                const int* listaQ = orientados.data() + inicioOrientado[q];
+                int grauQ = inicioOrientado[q + 1] - inicioOrientado[q];
+
+                comuns.resize(min(grauP, grauQ));
+                int encontrados = OperacoesSIMD::intersecao(listaP, grauP, listaQ, grauQ, comuns.data());
+                contagem[p] += encontrados;
+                contagem[q] += encontrados;
+                for (int k = 0; k < encontrados; k++) {
+                    contagem[comuns[k]]++;
+                }
+            }
+        }
+    });
+
+    triangulosPorVertice.assign(n, 0);
+    coeficienteLocal.assign(n, 0.0);
+    long long somaPorVertice = 0;
+    double caminhosDois = 0.0;
+    double somaCoeficientes = 0.0;
+    for (int v = 0; v < n; v++) {
+        for (const auto& contagem : parciais) {
+            if (!contagem.empty()) triangulosPorVertice[v] += contagem[posto[v]];
+        }
+        somaPorVertice += triangulosPorVertice[v];
+
+        if (grau[v] >= 2) {
+            double pares = grau[v] * (grau[v] - 1.0) / 2.0;
+            coeficienteLocal[v] = triangulosPorVertice[v] / pares;
+            caminhosDois += pares;
+            somaCoeficientes += coeficienteLocal[v];
+        }
+    }
+
+    numTriangulos = somaPorVertice / 3;
+    coeficienteMedio = n > 0 ? somaCoeficientes / n : 0.0;
+    transitividade = caminhosDois > 0 ? 3.0 * numTriangulos / caminhosDois : 0.0;
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+long long ContagemTriangulos::getNumTriangulos() const {
+    return numTriangulos;
+}
+
+const vector<long long>& ContagemTriangulos::getTriangulosPorVertice() const {
+    return triangulosPorVertice;
+}
+
+const vector<double>& ContagemTriangulos::getCoeficientesLocais() const {
+    return coeficienteLocal;
+}
+
+double ContagemTriangulos::getCoeficienteMedio() const {
+    return coeficienteMedio;
+}
+
+double ContagemTriangulos::getTransitividade() const {
+    return transitividade;
+}
+
+int ContagemTriangulos::getNumThreads() const {
+    return numThreads;
+}
+
+double ContagemTriangulos::getTempoMs() const {
+    return tempoMs;
+}
@@ -0,0 +1,48 @@
+#ifndef TRIANGULOS_H
+#define TRIANGULOS_H
+
+#include <vector>
+#include "../representacao_leitura/grafo_csr.h"
+using namespace std;
+
+// Contagem de triângulos e coeficientes de agrupamento. Os vértices são
+// renumerados por grau (empate: índice) e cada aresta é orientada do menor
+// para o maior posto, então cada triângulo aparece uma única vez, a partir do
+// seu vértice de menor posto, e nenhuma lista orientada passa de O(sqrt(m)).
+// Para cada aresta orientada (v, u) os terceiros vértices saem da interseção
+// das listas ordenadas de v e u (OperacoesSIMD::intersecao). Os vértices são
+// divididos em lotes entre as threads, cada uma com seu próprio contador por
+// vértice. Laços e arestas repetidas do arquivo são ignorados.
+class ContagemTriangulos {
+private:
+    int numThreads;
+    long long numTriangulos;
+    vector<long long> triangulosPorVertice;
+    vector<double> coeficienteLocal;
+    double coeficienteMedio;  // média dos coeficientes locais (grau < 2 conta 0)
+    double transitividade;    // 3 * triângulos / caminhos de comprimento 2
+    double tempoMs;
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    ContagemTriangulos(int numThreads = 0);
+
+    void calcular(const GrafoCSR& grafo);
+
+    long long getNumTriangulos() const;
+
+    // Vetores em base 0
+    const vector<long long>& getTriangulosPorVertice() const;
+
+    const vector<double>& getCoeficientesLocais() const;
+
+    double getCoeficienteMedio() const;
+
+    double getTransitividade() const;
+
+    int getNumThreads() const;
+
+    double getTempoMs() const;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#include "uniao_busca.h"
+#include <numeric>
+#include <utility>
+
+UniaoBusca::UniaoBusca(int numElementos) : numConjuntos(numElementos) {
+    pai.resize(numElementos);
+    iota(pai.begin(), pai.end(), 0);
+    posto.assign(numElementos, 0);
+    tamanho.assign(numElementos, 1);
+}
+
+int UniaoBusca::encontrar(int x) {
+    while (pai[x] != x) {
+        pai[x] = pai[pai[x]];
+        x = pai[x];
+    }
+    return x;
+}
+
+bool UniaoBusca::unir(int a, int b) {
+    a = encontrar(a);
+    b = encontrar(b);
+    if (a == b) {
+        return false;
+    }
+
+    if (posto[a] < posto[b]) {
+        swap(a, b);
+    }
+    pai[b] = a;
+    tamanho[a] += tamanho[b];
+    if (posto[a] == posto[b]) {
+        posto[a]++;
+    }
+    numConjuntos--;
+    return true;
+}
+
+bool UniaoBusca::mesmoConjunto(int a, int b) {
+    return encontrar(a) == encontrar(b);
+}
+
+int UniaoBusca::getTamanhoConjunto(int x) {
+    return tamanho[encontrar(x)];
+}
+
+int UniaoBusca::getNumConjuntos() const {
+    return numConjuntos;
+}
@@ -0,0 +1,31 @@
+#ifndef UNIAO_BUSCA_H
+#define UNIAO_BUSCA_H
+
+#include <vector>
+using namespace std;
+
+// Conjuntos disjuntos (union-find) com união por posto e compressão de
+// caminho por divisão ao meio. Vértices em base 0.
+class UniaoBusca {
+private:
+    vector<int> pai;
+    vector<unsigned char> posto; // altura máxima da árvore, nunca passa de log2(n)
+    vector<int> tamanho;         // válido nas raízes
+    int numConjuntos;
+
+public:
+    UniaoBusca(int numElementos);
+
+    int encontrar(int x);
+
+    // Retorna false se a e b já estavam no mesmo conjunto
+    bool unir(int a, int b);
+
+    bool mesmoConjunto(int a, int b);
+
+    int getTamanhoConjunto(int x);
+
+    int getNumConjuntos() const;
+};
+
+#endif
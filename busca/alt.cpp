@@ -0,0 +1,365 @@
+#include "alt.h"
+#include <iostream>
+#include <fstream>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include "../representacao_leitura/lista_adjacencia_peso_adapter.h"
+#include "../representacao_leitura/assinatura_grafo.h"
+
+namespace {
+const char MAGICO_ALT[4] = {'A', 'L', 'T', '2'};
+
+uint64_t assinaturaPesos(const ListaAdjacenciaPeso& grafo) {
+    return calcularAssinatura(ListaAdjacenciaPesoAdapter(grafo));
+}
+} // namespace
+
+ALT::ALT(int numVertices) : n(numVertices) {
+    tempoPreprocessamentoMs = 0.0;
+    assinaturaGrafo = 0;
+}
+
+double ALT::limiteInferior(int v, int t) const {
+    double limite = 0.0;
+
+    for (const auto& dist : distanciasMarcos) {
+        bool vInf = (dist[v] == INF);
+        bool tInf = (dist[t] == INF);
+
+        if (vInf && tInf) continue;
+
+        // Um alcança o marco e o outro não: estão em componentes diferentes
+        if (vInf != tInf) return INF;
+
+        limite = max(limite, fabs(dist[t] - dist[v]));
+    }
+
+    return limite;
+}
+
+void ALT::adicionarMarco(const ListaAdjacenciaPeso& grafo, int marco) {
+    ResultadoDijkstra resultado = Dijkstra::dijkstraHeap(grafo, marco + 1);
+    marcos.push_back(marco);
+    distanciasMarcos.push_back(move(resultado.distancias));
+}
+
+void ALT::escolherMarcosDistantes(const ListaAdjacenciaPeso& grafo, int numMarcos) {
+    mt19937 gen(42);
+    uniform_int_distribution<> dis(0, n - 1);
+
+    // Primeiro marco: o vértice mais distante de um vértice aleatório
+    if (marcos.empty()) {
+        ResultadoDijkstra inicial = Dijkstra::dijkstraHeap(grafo, dis(gen) + 1);
+        int maisDistante = inicial.origem - 1;
+        for (int v = 0; v < n; v++) {
+            if (inicial.distancias[v] != INF &&
+                inicial.distancias[v] > inicial.distancias[maisDistante]) {
+                maisDistante = v;
+            }
+        }
+        adicionarMarco(grafo, maisDistante);
+    }
+
+    vector<double> menorDistancia(n, INF);
+    for (const auto& dist : distanciasMarcos) {
+        for (int v = 0; v < n; v++) {
+            menorDistancia[v] = min(menorDistancia[v], dist[v]);
+        }
+    }
+
+    while (static_cast<int>(marcos.size()) < numMarcos) {
+        // Vértices inalcançáveis por todos os marcos (INF) têm prioridade:
+        // cobrem componentes que ainda não possuem marco
+        int escolhido = -1;
+        for (int v = 0; v < n; v++) {
+            if (escolhido == -1 || menorDistancia[v] > menorDistancia[escolhido]) {
+                escolhido = v;
+            }
+        }
+
+        if (escolhido == -1 || menorDistancia[escolhido] == 0.0) {
+            break; // todos os vértices já são marcos
+        }
+
+        adicionarMarco(grafo, escolhido);
+        const vector<double>& dist = distanciasMarcos.back();
+        for (int v = 0; v < n; v++) {
+            menorDistancia[v] = min(menorDistancia[v], dist[v]);
+        }
+    }
+}
+
+void ALT::escolherMarcosEvitar(const ListaAdjacenciaPeso& grafo, int numMarcos) {
+    mt19937 gen(42);
+    uniform_int_distribution<> dis(0, n - 1);
+
+    vector<bool> ehMarco(n, false);
+    for (int m : marcos) ehMarco[m] = true;
+
+    int tentativas = 0;
+    while (static_cast<int>(marcos.size()) < numMarcos && tentativas < 4 * numMarcos) {
+        tentativas++;
+
+        int raiz = dis(gen);
+        ResultadoDijkstra arvore = Dijkstra::dijkstraHeap(grafo, raiz + 1);
+
+        // Filhos na árvore de caminhos mínimos e ordem de visita a partir da raiz
+        vector<vector<int>> filhos(n);
+        for (int v = 0; v < n; v++) {
+            if (arvore.predecessores[v] != -1) {
+                filhos[arvore.predecessores[v] - 1].push_back(v);
+            }
+        }
+
+        vector<int> ordem;
+        ordem.push_back(raiz);
+        for (size_t i = 0; i < ordem.size(); i++) {
+            for (int filho : filhos[ordem[i]]) {
+                ordem.push_back(filho);
+            }
+        }
+
+        // peso(v) = d(raiz, v) - limite inferior atual; tamanho(v) soma os pesos
+        // da subárvore, ou zero se a subárvore já contém um marco
+        vector<double> tamanho(n, 0.0);
+        vector<bool> contemMarco(n, false);
+        for (int i = ordem.size() - 1; i >= 0; i--) {
+            int v = ordem[i];
+            tamanho[v] += arvore.distancias[v] - limiteInferior(raiz, v);
+            contemMarco[v] = contemMarco[v] || ehMarco[v];
+
+            if (contemMarco[v]) {
+                tamanho[v] = 0.0;
+            }
+
+            int pai = arvore.predecessores[v] - 1;
+            if (pai >= 0) {
+                tamanho[pai] += tamanho[v];
+                contemMarco[pai] = contemMarco[pai] || contemMarco[v];
+            }
+        }
+
+        // Desce pelo filho de maior tamanho até chegar a uma folha
+        int atual = raiz;
+        while (true) {
+            int melhor = -1;
+            for (int filho : filhos[atual]) {
+                if (tamanho[filho] > 0.0 && (melhor == -1 || tamanho[filho] > tamanho[melhor])) {
+                    melhor = filho;
+                }
+            }
+            if (melhor == -1) break;
+            atual = melhor;
+        }
+
+        if (!ehMarco[atual]) {
+            ehMarco[atual] = true;
+            adicionarMarco(grafo, atual);
+        }
+    }
+
+    // Completa com a heurística de distância caso não haja folhas novas suficientes
+    if (static_cast<int>(marcos.size()) < numMarcos) {
+        escolherMarcosDistantes(grafo, numMarcos);
+    }
+}
+
+void ALT::preprocessar(const ListaAdjacenciaPeso& grafo, int numMarcos, HeuristicaMarcos heuristica) {
+    if (numMarcos < 1) {
+        throw invalid_argument("Número de marcos deve ser positivo");
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+
+    marcos.clear();
+    distanciasMarcos.clear();
+    numMarcos = min(numMarcos, n);
+    assinaturaGrafo = assinaturaPesos(grafo);
+
+    if (heuristica == HeuristicaMarcos::DISTANTE) {
+        escolherMarcosDistantes(grafo, numMarcos);
+    } else {
+        escolherMarcosEvitar(grafo, numMarcos);
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoPreprocessamentoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+ResultadoConsultaALT ALT::consultar(const ListaAdjacenciaPeso& grafo, int origem, int destino) const {
+    if (origem < 1 || origem > n || destino < 1 || destino > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+
+    ResultadoConsultaALT resultado;
+    resultado.distancia = INF;
+    resultado.verticesVisitados = 0;
+
+    int s = origem - 1;
+    int t = destino - 1;
+
+    if (limiteInferior(s, t) == INF) {
+        return resultado;
+    }
+
+    const auto& L = grafo.getLista();
+    vector<double> g(n, INF);
+    vector<int> pred(n, -1);
+    vector<bool> fechado(n, false);
+
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+    g[s] = 0.0;
+    pq.push({limiteInferior(s, t), s});
+
+    while (!pq.empty()) {
+        int u = pq.top().second;
+        pq.pop();
+
+        if (fechado[u]) continue;
+        fechado[u] = true;
+        resultado.verticesVisitados++;
+
+        if (u == t) break;
+
+        for (const auto& [vizinho_1based, peso] : L[u]) {
+            int v = vizinho_1based - 1;
+            double novaDist = g[u] + peso;
+            if (novaDist < g[v]) {
+                double h = limiteInferior(v, t);
+                if (h == INF) continue;
+                g[v] = novaDist;
+                pred[v] = u;
+                pq.push({novaDist + h, v});
+            }
+        }
+    }
+
+    if (g[t] == INF) {
+        return resultado;
+    }
+
+    resultado.distancia = g[t];
+    for (int v = t; v != -1; v = pred[v]) {
+        resultado.caminho.push_back(v + 1);
+    }
+    reverse(resultado.caminho.begin(), resultado.caminho.end());
+
+    return resultado;
+}
+
+void ALT::salvarEmArquivo(const string& nomeArquivo) const {
+    ofstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        throw runtime_error("Erro ao criar arquivo de marcos");
+    }
+
+    int32_t numVertices = n;
+    int32_t k = marcos.size();
+
+    arquivo.write(MAGICO_ALT, sizeof(MAGICO_ALT));
+    arquivo.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+    arquivo.write(reinterpret_cast<const char*>(&k), sizeof(k));
+    arquivo.write(reinterpret_cast<const char*>(&assinaturaGrafo), sizeof(assinaturaGrafo));
+
+    for (int m : marcos) {
+        int32_t marco = m;
+        arquivo.write(reinterpret_cast<const char*>(&marco), sizeof(marco));
+    }
+
+    for (const auto& dist : distanciasMarcos) {
+        arquivo.write(reinterpret_cast<const char*>(dist.data()), n * sizeof(double));
+    }
+
+    if (!arquivo) {
+        throw runtime_error("Erro ao gravar arquivo de marcos");
+    }
+}
+
+bool ALT::carregarDeArquivo(const string& nomeArquivo, const ListaAdjacenciaPeso& grafo) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        return false;
+    }
+
+    char magico[4];
+    int32_t numVertices = 0;
+    int32_t k = 0;
+    uint64_t assinatura = 0;
+
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&numVertices), sizeof(numVertices));
+    arquivo.read(reinterpret_cast<char*>(&k), sizeof(k));
+    arquivo.read(reinterpret_cast<char*>(&assinatura), sizeof(assinatura));
+
+    // Distâncias de outra versão do grafo deixariam o limite do A* acima do real
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_ALT) ||
+        numVertices != n || k < 1 || k > n ||
+        assinatura != assinaturaPesos(grafo)) {
+        return false;
+    }
+
+    vector<int> novosMarcos(k);
+    for (int i = 0; i < k; i++) {
+        int32_t marco = 0;
+        arquivo.read(reinterpret_cast<char*>(&marco), sizeof(marco));
+        if (marco < 0 || marco >= n) return false;
+        novosMarcos[i] = marco;
+    }
+
+    vector<vector<double>> novasDistancias(k, vector<double>(n));
+    for (auto& dist : novasDistancias) {
+        arquivo.read(reinterpret_cast<char*>(dist.data()), n * sizeof(double));
+    }
+
+    if (!arquivo) {
+        return false;
+    }
+
+    marcos = move(novosMarcos);
+    distanciasMarcos = move(novasDistancias);
+    assinaturaGrafo = assinatura;
+    tempoPreprocessamentoMs = 0.0;
+    return true;
+}
+
+string ALT::caminhoArquivoMarcos(const string& caminhoGrafo) {
+    return caminhoGrafo + ".alt";
+}
+
+int ALT::getNumMarcos() const {
+    return marcos.size();
+}
+
+const vector<int>& ALT::getMarcos() const {
+    return marcos;
+}
+
+double ALT::getTempoPreprocessamentoMs() const {
+    return tempoPreprocessamentoMs;
+}
+
+size_t ALT::getMemoriaPorMarco() const {
+    return n * sizeof(double) + sizeof(int);
+}
+
+void ALT::imprimirResumo() const {
+    cout << "Marcos ALT (" << marcos.size() << "): ";
+    for (size_t i = 0; i < marcos.size(); i++) {
+        if (i > 0) cout << ", ";
+        cout << (marcos[i] + 1);
+    }
+    cout << "\n";
+
+    cout << fixed << setprecision(3);
+    cout << "• Tempo de pré-processamento: " << tempoPreprocessamentoMs << " ms\n";
+    cout << "• Memória por marco: " << setprecision(2)
+         << getMemoriaPorMarco() / 1024.0 << " KB\n";
+    cout << "• Memória total: "
+         << (getMemoriaPorMarco() * marcos.size()) / (1024.0 * 1024.0) << " MB\n";
+}
@@ -0,0 +1,69 @@
+#ifndef ALT_H
+#define ALT_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "../representacao_leitura/lista_adjacencia_peso.h"
+#include "dijkstra.h"
+using namespace std;
+
+// Heurísticas de escolha dos marcos (landmarks)
+enum class HeuristicaMarcos {
+    DISTANTE, // farthest: cada novo marco é o vértice mais distante dos já escolhidos
+    EVITAR    // avoid: desce na árvore de caminhos mínimos onde os limites são piores
+};
+
+struct ResultadoConsultaALT {
+    double distancia;
+    vector<int> caminho;    // vértices em base 1, da origem ao destino
+    int verticesVisitados;  // vértices removidos da fila de prioridade
+};
+
+// A* com marcos e desigualdade triangular (ALT).
+// Para cada marco L guardamos d(L, v) para todo v; como o grafo é não
+// direcionado, |d(L, t) - d(L, v)| é um limite inferior válido para d(v, t).
+class ALT {
+private:
+    int n;
+    vector<int> marcos;                     // base 0
+    vector<vector<double>> distanciasMarcos; // [marco][vértice]
+    double tempoPreprocessamentoMs;
+    uint64_t assinaturaGrafo; // vértices, vizinhos e pesos; valida o arquivo de marcos
+
+    double limiteInferior(int v, int t) const;
+
+    void escolherMarcosDistantes(const ListaAdjacenciaPeso& grafo, int numMarcos);
+    void escolherMarcosEvitar(const ListaAdjacenciaPeso& grafo, int numMarcos);
+    void adicionarMarco(const ListaAdjacenciaPeso& grafo, int marco);
+
+public:
+    ALT(int numVertices);
+
+    void preprocessar(const ListaAdjacenciaPeso& grafo, int numMarcos,
+                      HeuristicaMarcos heuristica = HeuristicaMarcos::EVITAR);
+
+    // origem e destino em base 1
+    ResultadoConsultaALT consultar(const ListaAdjacenciaPeso& grafo, int origem, int destino) const;
+
+    void salvarEmArquivo(const string& nomeArquivo) const;
+
+    // Retorna false se o arquivo não existir ou não corresponder ao grafo
+    bool carregarDeArquivo(const string& nomeArquivo, const ListaAdjacenciaPeso& grafo);
+
+    // Arquivo de marcos gravado ao lado do arquivo do grafo
+    static string caminhoArquivoMarcos(const string& caminhoGrafo);
+
+    int getNumMarcos() const;
+
+    const vector<int>& getMarcos() const;
+
+    double getTempoPreprocessamentoMs() const;
+
+    size_t getMemoriaPorMarco() const;
+
+    void imprimirResumo() const;
+};
+
+#endif
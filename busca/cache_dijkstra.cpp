@@ -0,0 +1,109 @@
+#include "cache_dijkstra.h"
+#include <iostream>
+#include <iomanip>
+
+CacheDijkstra::CacheDijkstra(size_t orcamentoBytes, bool distanciasFloat)
+    : orcamentoBytes(orcamentoBytes), distanciasFloat(distanciasFloat) {
+    memoriaBytes = 0;
+    consultas = 0;
+    acertos = 0;
+    remocoes = 0;
+}
+
+string CacheDijkstra::montarChave(const string& grafo, int origem, const string& estrategia) {
+    return grafo + "|" + to_string(origem) + "|" + estrategia;
+}
+
+bool CacheDijkstra::obter(const string& grafo, int origem, const string& estrategia,
+                          ResultadoDijkstra& resultado) {
+    consultas++;
+
+    auto it = indice.find(montarChave(grafo, origem, estrategia));
+    if (it == indice.end()) {
+        return false;
+    }
+
+    acertos++;
+    entradas.splice(entradas.begin(), entradas, it->second);
+
+    const Entrada& entrada = *it->second;
+    resultado.origem = entrada.origem;
+    if (distanciasFloat) {
+        resultado.distancias.assign(entrada.distanciasCompactas.begin(), entrada.distanciasCompactas.end());
+    } else {
+        resultado.distancias = entrada.distancias;
+    }
+    resultado.predecessores = entrada.predecessores;
+    return true;
+}
+
+void CacheDijkstra::inserir(const string& grafo, const string& estrategia, const ResultadoDijkstra& resultado) {
+    string chave = montarChave(grafo, resultado.origem, estrategia);
+
+    size_t n = resultado.distancias.size();
+    size_t bytes = n * ((distanciasFloat ? sizeof(float) : sizeof(double)) + sizeof(int)) +
+                   sizeof(Entrada) + chave.size();
+    if (bytes > orcamentoBytes) {
+        return;
+    }
+
+    auto existente = indice.find(chave);
+    if (existente != indice.end()) {
+        memoriaBytes -= existente->second->bytes;
+        entradas.erase(existente->second);
+        indice.erase(existente);
+    }
+
+    while (memoriaBytes + bytes > orcamentoBytes) {
+        memoriaBytes -= entradas.back().bytes;
+        indice.erase(entradas.back().chave);
+        entradas.pop_back();
+        remocoes++;
+    }
+
+    Entrada entrada;
+    entrada.chave = chave;
+    entrada.origem = resultado.origem;
+    if (distanciasFloat) {
+        entrada.distanciasCompactas.assign(resultado.distancias.begin(), resultado.distancias.end());
+    } else {
+        entrada.distancias = resultado.distancias;
+    }
+    entrada.predecessores = resultado.predecessores;
+    entrada.bytes = bytes;
+
+    entradas.push_front(move(entrada));
+    indice[chave] = entradas.begin();
+    memoriaBytes += bytes;
+}
+
+void CacheDijkstra::limpar() {
+    entradas.clear();
+    indice.clear();
+    memoriaBytes = 0;
+}
+
+void CacheDijkstra::setDistanciasFloat(bool distanciasFloat) {
+    if (distanciasFloat != this->distanciasFloat) {
+        limpar();
+        this->distanciasFloat = distanciasFloat;
+    }
+}
+
+bool CacheDijkstra::getDistanciasFloat() const {
+    return distanciasFloat;
+}
+
+EstatisticasCache CacheDijkstra::getEstatisticas() const {
+    return {consultas, acertos, remocoes, entradas.size(), memoriaBytes};
+}
+
+void CacheDijkstra::imprimirEstatisticas() const {
+    double taxa = consultas > 0 ? 100.0 * acertos / consultas : 0.0;
+    cout << fixed << setprecision(1);
+    cout << "• Cache de Dijkstra: " << entradas.size() << " árvores, "
+         << memoriaBytes / (1024.0 * 1024.0) << " de " << orcamentoBytes / (1024.0 * 1024.0) << " MB"
+         << (distanciasFloat ? " (distâncias em float)" : "") << "\n";
+    cout << "• Acertos: " << acertos << "/" << consultas << " (" << taxa << "%), remoções LRU: "
+         << remocoes << "\n";
+}
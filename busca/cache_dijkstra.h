@@ -0,0 +1,68 @@
+#ifndef CACHE_DIJKSTRA_H
+#define CACHE_DIJKSTRA_H
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "dijkstra.h"
+using namespace std;
+
+struct EstatisticasCache {
+    long long consultas;
+    long long acertos;
+    long long remocoes;   // entradas descartadas por falta de espaço
+    size_t entradas;
+    size_t memoriaBytes;
+};
+
+// Cache de árvores de caminhos mínimos, chaveado por (grafo, origem, estratégia).
+// Quando o orçamento de memória estoura, a entrada usada há mais tempo sai
+// primeiro (LRU). Por padrão as distâncias ficam em double, idênticas às de
+// um Dijkstra novo; com distanciasFloat são guardadas em float, o que reduz
+// cada entrada de 12 para 8 bytes por vértice ao custo de arredondá-las.
+class CacheDijkstra {
+private:
+    struct Entrada {
+        string chave;
+        int origem;
+        vector<double> distancias;
+        vector<float> distanciasCompactas;
+        vector<int> predecessores;
+        size_t bytes;
+    };
+
+    size_t orcamentoBytes;
+    bool distanciasFloat;
+    list<Entrada> entradas; // mais recente na frente
+    unordered_map<string, list<Entrada>::iterator> indice;
+    size_t memoriaBytes;
+    long long consultas;
+    long long acertos;
+    long long remocoes;
+
+    static string montarChave(const string& grafo, int origem, const string& estrategia);
+
+public:
+    CacheDijkstra(size_t orcamentoBytes, bool distanciasFloat = false);
+
+    // Copia o resultado guardado para "resultado"; false se não estiver no cache
+    bool obter(const string& grafo, int origem, const string& estrategia, ResultadoDijkstra& resultado);
+
+    // Resultados maiores que o orçamento inteiro não são guardados
+    void inserir(const string& grafo, const string& estrategia, const ResultadoDijkstra& resultado);
+
+    void limpar();
+
+    // Trocar o formato descarta as entradas guardadas no formato anterior
+    void setDistanciasFloat(bool distanciasFloat);
+
+    bool getDistanciasFloat() const;
+
+    EstatisticasCache getEstatisticas() const;
+
+    void imprimirEstatisticas() const;
+};
+
+#endif
@@ -1,6 +1,9 @@
 #include "dijkstra.h"
+#include "operacoes_simd.h"
 #include <iostream>
 #include <queue>
+#include <deque>
+#include <sstream>
 #include <algorithm>
 #include <iomanip>
 
@@ -8,21 +11,27 @@ const double INF = numeric_limits<double>::infinity();
 
 ResultadoDijkstra Dijkstra::executar(const IGrafoPeso& grafo, int origem,
                                     unique_ptr<IDijkstraStrategy> strategy) {
+    ResultadoDijkstra resultado;
+    executarEm(grafo, origem, *strategy, resultado);
+    return resultado;
+}
+
+void Dijkstra::executarEm(const IGrafoPeso& grafo, int origem,
+                          IDijkstraStrategy& strategy, ResultadoDijkstra& resultado) {
     int n = grafo.getNumVertices();
 
-    ResultadoDijkstra resultado;
     resultado.origem = origem;
     resultado.distancias.assign(n, INF);
     resultado.predecessores.assign(n, -1);
 
-    strategy->inicializar(n);
+    strategy.inicializar(n);
 
     int origemIdx = origem - 1;
     resultado.distancias[origemIdx] = 0;
-    strategy->inserirOuAtualizar(origemIdx, 0);
+    strategy.inserirOuAtualizar(origemIdx, 0);
 
-    while (!strategy->vazio()) {
-        int u = strategy->extrairMinimo();
+    while (!strategy.vazio()) {
+        int u = strategy.extrairMinimo();
 
         if (u == -1 || resultado.distancias[u] == INF) {
             break;
@@ -34,12 +43,10 @@ ResultadoDijkstra Dijkstra::executar(const IGrafoPeso& grafo, int origem,
             if (resultado.distancias[u] + peso < resultado.distancias[v]) {
                 resultado.distancias[v] = resultado.distancias[u] + peso;
                 resultado.predecessores[v] = u + 1;
-                strategy->inserirOuAtualizar(v, resultado.distancias[v]);
+                strategy.inserirOuAtualizar(v, resultado.distancias[v]);
             }
         }
     }
-
-    return resultado;
 }
 
 ResultadoDijkstra Dijkstra::dijkstraVetor(const ListaAdjacenciaPeso& grafo, int origem) {
@@ -54,6 +61,155 @@ ResultadoDijkstra Dijkstra::dijkstraHeap(const ListaAdjacenciaPeso& grafo, int o
     return executar(adapter, origem, move(strategy));
 }
 
+ResultadoDijkstra Dijkstra::dijkstraTorneio(const ListaAdjacenciaPeso& grafo, int origem) {
+    ListaAdjacenciaPesoAdapter adapter(grafo);
+    auto strategy = make_unique<DijkstraTorneioStrategy>();
+    return executar(adapter, origem, move(strategy));
+}
+
+ResultadoDijkstra Dijkstra::dijkstraMatriz(const MatrizAdjacenciaPeso& grafo, int origem) {
+    int n = grafo.getNumVertices();
+
+    ResultadoDijkstra resultado;
+    resultado.origem = origem;
+    resultado.distancias.assign(n, INF);
+    resultado.predecessores.assign(n, -1);
+
+    // chaves[v] = distância provisória de v, ou INF depois que v é fechado
+    vector<double> chaves(n, INF);
+
+    int origemIdx = origem - 1;
+    resultado.distancias[origemIdx] = 0;
+    chaves[origemIdx] = 0;
+
+    for (int passo = 0; passo < n; passo++) {
+        int u = OperacoesSIMD::argmin(chaves.data(), n);
+        if (u == -1) {
+            break;
+        }
+        chaves[u] = INF;
+
+        OperacoesSIMD::relaxarLinha(grafo.getLinha(u), resultado.distancias[u],
+                                    resultado.distancias.data(), chaves.data(),
+                                    resultado.predecessores.data(), u + 1, n);
+    }
+
+    return resultado;
+}
+
+ResultadoDijkstra Dijkstra::bfsPesoUniforme(const ListaAdjacenciaPeso& grafo, int origem) {
+    int n = grafo.getNumVertices();
+    const auto& L = grafo.getLista();
+    double peso = grafo.getPesoUniforme();
+
+    ResultadoDijkstra resultado;
+    resultado.origem = origem;
+    resultado.distancias.assign(n, INF);
+    resultado.predecessores.assign(n, -1);
+
+    vector<int> fila;
+    fila.reserve(n);
+    fila.push_back(origem - 1);
+    resultado.distancias[origem - 1] = 0;
+
+    for (size_t i = 0; i < fila.size(); i++) {
+        int u = fila[i];
+        double proxima = resultado.distancias[u] + peso;
+        for (const auto& aresta : L[u]) {
+            int v = aresta.first - 1;
+            if (resultado.distancias[v] == INF) {
+                resultado.distancias[v] = proxima;
+                resultado.predecessores[v] = u + 1;
+                fila.push_back(v);
+            }
+        }
+    }
+
+    return resultado;
+}
+
+ResultadoDijkstra Dijkstra::bfsZeroUm(const ListaAdjacenciaPeso& grafo, int origem) {
+    int n = grafo.getNumVertices();
+    const auto& L = grafo.getLista();
+
+    ResultadoDijkstra resultado;
+    resultado.origem = origem;
+    resultado.distancias.assign(n, INF);
+    resultado.predecessores.assign(n, -1);
+
+    // Arestas de peso 0 entram na frente, de peso 1 atrás: o deque fica
+    // ordenado por distância com no máximo dois valores distintos
+    deque<int> fila;
+    vector<bool> fechado(n, false);
+    fila.push_back(origem - 1);
+    resultado.distancias[origem - 1] = 0;
+
+    while (!fila.empty()) {
+        int u = fila.front();
+        fila.pop_front();
+
+        if (fechado[u]) continue;
+        fechado[u] = true;
+
+        for (const auto& [vizinho_1based, peso] : L[u]) {
+            int v = vizinho_1based - 1;
+            double novaDist = resultado.distancias[u] + peso;
+            if (novaDist < resultado.distancias[v]) {
+                resultado.distancias[v] = novaDist;
+                resultado.predecessores[v] = u + 1;
+                if (peso == 0.0) {
+                    fila.push_front(v);
+                } else {
+                    fila.push_back(v);
+                }
+            }
+        }
+    }
+
+    return resultado;
+}
+
+MotorCaminhos Dijkstra::escolherMotor(const ListaAdjacenciaPeso& grafo) {
+    switch (grafo.getDominioPesos()) {
+        case DominioPesos::UNIFORME:
+            return MotorCaminhos::BFS;
+        case DominioPesos::ZERO_UM:
+            return MotorCaminhos::BFS_ZERO_UM;
+        default:
+            return MotorCaminhos::ESTRATEGIA;
+    }
+}
+
+string Dijkstra::descreverMotor(MotorCaminhos motor, const ListaAdjacenciaPeso& grafo) {
+    ostringstream descricao;
+    switch (motor) {
+        case MotorCaminhos::BFS:
+            descricao << "BFS (todas as arestas têm peso " << grafo.getPesoUniforme() << ")";
+            break;
+        case MotorCaminhos::BFS_ZERO_UM:
+            descricao << "0-1 BFS com deque (todos os pesos são 0 ou 1)";
+            break;
+        default:
+            descricao << "estratégia configurada (pesos gerais)";
+            break;
+    }
+    return descricao.str();
+}
+
+ResultadoDijkstra Dijkstra::executarAutomatico(const ListaAdjacenciaPeso& grafo, int origem,
+                                               unique_ptr<IDijkstraStrategy> strategy) {
+    switch (escolherMotor(grafo)) {
+        case MotorCaminhos::BFS:
+            return bfsPesoUniforme(grafo, origem);
+        case MotorCaminhos::BFS_ZERO_UM:
+            return bfsZeroUm(grafo, origem);
+        default: {
+            ListaAdjacenciaPesoAdapter adapter(grafo);
+            return executar(adapter, origem, move(strategy));
+        }
+    }
+}
+
 void Dijkstra::imprimirResultado(const ResultadoDijkstra& resultado) {
     cout << "Distancias minimas a partir do vertice " << resultado.origem << ":\n";
     cout << fixed << setprecision(1);
@@ -4,12 +4,15 @@
 #include <vector>
 #include <limits>
 #include <memory>
+#include <string>
 #include "../representacao_leitura/lista_adjacencia_peso.h"
+#include "../representacao_leitura/matriz_adjacencia_peso.h"
 #include "../representacao_leitura/grafo_peso_interface.h"
 #include "../representacao_leitura/lista_adjacencia_peso_adapter.h"
 #include "dijkstra_strategy.h"
 #include "dijkstra_vetor_strategy.h"
 #include "dijkstra_heap_strategy.h"
+#include "dijkstra_torneio_strategy.h"
 using namespace std;
 
 extern const double INF;
@@ -20,14 +23,41 @@ struct ResultadoDijkstra {
     int origem;
 };
 
+// Motor usado por Dijkstra::executarAutomatico, conforme o domínio dos pesos
+enum class MotorCaminhos {
+    BFS,          // pesos uniformes: distância = nível * peso
+    BFS_ZERO_UM,  // pesos 0 e 1: deque no lugar da fila de prioridade
+    ESTRATEGIA    // pesos gerais: a estratégia configurada
+};
+
 class Dijkstra {
 public:
 
     static ResultadoDijkstra executar(const IGrafoPeso& grafo, int origem,
                                      unique_ptr<IDijkstraStrategy> strategy);
 
+    // Reaproveita a estratégia e os vetores de resultado entre execuções
+    static void executarEm(const IGrafoPeso& grafo, int origem,
+                           IDijkstraStrategy& strategy, ResultadoDijkstra& resultado);
+
     static ResultadoDijkstra dijkstraVetor(const ListaAdjacenciaPeso& grafo, int origem);
     static ResultadoDijkstra dijkstraHeap(const ListaAdjacenciaPeso& grafo, int origem);
+    static ResultadoDijkstra dijkstraTorneio(const ListaAdjacenciaPeso& grafo, int origem);
+
+    // O(n^2) sobre a matriz densa: cada passo relaxa a linha inteira com SIMD
+    static ResultadoDijkstra dijkstraMatriz(const MatrizAdjacenciaPeso& grafo, int origem);
+
+    static ResultadoDijkstra bfsPesoUniforme(const ListaAdjacenciaPeso& grafo, int origem);
+    static ResultadoDijkstra bfsZeroUm(const ListaAdjacenciaPeso& grafo, int origem);
+
+    static MotorCaminhos escolherMotor(const ListaAdjacenciaPeso& grafo);
+
+    // Nome do motor e o motivo da escolha, para exibição
+    static string descreverMotor(MotorCaminhos motor, const ListaAdjacenciaPeso& grafo);
+
+    // BFS, 0-1 BFS ou a estratégia informada, conforme o domínio detectado na carga
+    static ResultadoDijkstra executarAutomatico(const ListaAdjacenciaPeso& grafo, int origem,
+                                                unique_ptr<IDijkstraStrategy> strategy);
 
     static void imprimirResultado(const ResultadoDijkstra& resultado);
 
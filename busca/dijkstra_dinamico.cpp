@@ -0,0 +1,137 @@
+#include "dijkstra_dinamico.h"
+#include <queue>
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+// Menor peso entre u e v no grafo atual (base 0), INF se não houver aresta
+double menorPeso(const vector<vector<pair<int, double>>>& L, int u, int v) {
+    double menor = INF;
+    for (const auto& [vizinho_1based, peso] : L[u]) {
+        if (vizinho_1based == v + 1 && peso < menor) {
+            menor = peso;
+        }
+    }
+    return menor;
+}
+} // namespace
+
+void DijkstraDinamico::aplicarAlteracoes(ListaAdjacenciaPeso& grafo,
+                                         const vector<AlteracaoAresta>& alteracoes) {
+    for (const auto& alteracao : alteracoes) {
+        if (alteracao.tipo == TipoAlteracao::REMOVER) {
+            grafo.removerAresta(alteracao.origem, alteracao.destino);
+        } else {
+            grafo.definirAresta(alteracao.origem, alteracao.destino, alteracao.peso);
+        }
+    }
+}
+
+EstatisticasReparo DijkstraDinamico::reparar(const ListaAdjacenciaPeso& grafo, ResultadoDijkstra& resultado,
+                                             const vector<AlteracaoAresta>& alteracoes) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    const auto& L = grafo.getLista();
+    int n = grafo.getNumVertices();
+    if (static_cast<int>(resultado.distancias.size()) != n) {
+        throw invalid_argument("Resultado não corresponde ao grafo");
+    }
+
+    vector<double>& dist = resultado.distancias;
+    vector<int>& pred = resultado.predecessores; // base 1, -1 sem predecessor
+
+    EstatisticasReparo estatisticas{0, 0, 0.0};
+
+    // 1. Raízes invalidadas: filho de uma aresta da árvore que deixou de
+    //    ser justa (removida ou com peso maior)
+    vector<int> invalidados;
+    vector<bool> invalido(n, false);
+    for (const auto& alteracao : alteracoes) {
+        int a = alteracao.origem - 1;
+        int b = alteracao.destino - 1;
+        if (a < 0 || a >= n || b < 0 || b >= n) {
+            throw invalid_argument("Vértice inválido");
+        }
+
+        for (auto [pai, filho] : {make_pair(a, b), make_pair(b, a)}) {
+            if (pred[filho] != pai + 1 || invalido[filho]) continue;
+            if (dist[pai] + menorPeso(L, pai, filho) > dist[filho]) {
+                invalido[filho] = true;
+                invalidados.push_back(filho);
+            }
+        }
+    }
+
+    // Subárvores das raízes: os filhos de x na árvore são vizinhos de x
+    // com predecessor x, então basta olhar a vizinhança de cada vértice
+    for (size_t i = 0; i < invalidados.size(); i++) {
+        int x = invalidados[i];
+        for (const auto& [vizinho_1based, peso] : L[x]) {
+            int y = vizinho_1based - 1;
+            if (!invalido[y] && pred[y] == x + 1) {
+                invalido[y] = true;
+                invalidados.push_back(y);
+            }
+        }
+    }
+    estatisticas.verticesInvalidados = invalidados.size();
+
+    for (int x : invalidados) {
+        dist[x] = INF;
+        pred[x] = -1;
+    }
+
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+
+    // Sementes da região invalidada: melhor vizinho ainda válido
+    for (int x : invalidados) {
+        for (const auto& [vizinho_1based, peso] : L[x]) {
+            int y = vizinho_1based - 1;
+            if (!invalido[y] && dist[y] + peso < dist[x]) {
+                dist[x] = dist[y] + peso;
+                pred[x] = y + 1;
+            }
+        }
+        if (dist[x] != INF) {
+            pq.push({dist[x], x});
+        }
+    }
+
+    // 2. Arestas novas ou mais baratas
+    for (const auto& alteracao : alteracoes) {
+        if (alteracao.tipo == TipoAlteracao::REMOVER) continue;
+
+        int a = alteracao.origem - 1;
+        int b = alteracao.destino - 1;
+        double peso = menorPeso(L, a, b);
+        for (auto [u, v] : {make_pair(a, b), make_pair(b, a)}) {
+            if (dist[u] + peso < dist[v]) {
+                dist[v] = dist[u] + peso;
+                pred[v] = u + 1;
+                pq.push({dist[v], v});
+            }
+        }
+    }
+
+    // 3. Dijkstra restrito às sementes
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+
+        if (d != dist[u]) continue;
+        estatisticas.verticesReprocessados++;
+
+        for (const auto& [vizinho_1based, peso] : L[u]) {
+            int v = vizinho_1based - 1;
+            if (dist[u] + peso < dist[v]) {
+                dist[v] = dist[u] + peso;
+                pred[v] = u + 1;
+                pq.push({dist[v], v});
+            }
+        }
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    estatisticas.tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+    return estatisticas;
+}
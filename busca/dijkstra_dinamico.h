@@ -0,0 +1,45 @@
+#ifndef DIJKSTRA_DINAMICO_H
+#define DIJKSTRA_DINAMICO_H
+
+#include <vector>
+#include "../representacao_leitura/lista_adjacencia_peso.h"
+#include "dijkstra.h"
+using namespace std;
+
+enum class TipoAlteracao {
+    INSERIR,      // nova aresta (ou novo peso, se já existir)
+    REMOVER,
+    ALTERAR_PESO
+};
+
+struct AlteracaoAresta {
+    TipoAlteracao tipo;
+    int origem;   // base 1
+    int destino;  // base 1
+    double peso;  // ignorado em REMOVER
+};
+
+struct EstatisticasReparo {
+    int verticesInvalidados; // subárvores descartadas por remoção ou aumento de peso
+    int verticesReprocessados; // vértices retirados da fila durante o reparo
+    double tempoMs;
+};
+
+// Atualização incremental de caminhos mínimos de fonte única, no estilo de
+// Ramalingam-Reps. Depois que um lote de alterações é aplicado ao grafo:
+// 1. arestas da árvore que sumiram ou ficaram mais caras invalidam a subárvore
+//    abaixo delas, que volta a INF e é semeada pelos vizinhos válidos;
+// 2. arestas novas ou mais baratas semeiam seus extremos se melhorarem algo;
+// 3. um único Dijkstra a partir dessas sementes propaga as mudanças.
+// Só a região afetada é percorrida; o grafo é não direcionado, pesos >= 0.
+class DijkstraDinamico {
+public:
+    // Aplica o lote ao grafo (uma vez, antes de reparar os resultados)
+    static void aplicarAlteracoes(ListaAdjacenciaPeso& grafo, const vector<AlteracaoAresta>& alteracoes);
+
+    // Repara um resultado calculado antes do lote; o grafo já deve estar alterado
+    static EstatisticasReparo reparar(const ListaAdjacenciaPeso& grafo, ResultadoDijkstra& resultado,
+                                      const vector<AlteracaoAresta>& alteracoes);
+};
+
+#endif
@@ -0,0 +1,103 @@
+#include "dijkstra_paralelo.h"
+#include "execucao_paralela.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+
+DijkstraParalelo::DijkstraParalelo(int numThreads, FabricaEstrategiaDijkstra fabrica)
+    : numThreads(ExecucaoParalela::resolverNumThreads(numThreads)), fabrica(move(fabrica)) {
+    if (!this->fabrica) {
+        this->fabrica = []() -> unique_ptr<IDijkstraStrategy> {
+            return make_unique<DijkstraHeapStrategy>();
+        };
+    }
+}
+
+void DijkstraParalelo::executarIndices(const IGrafoPeso& grafo, const vector<int>& origens,
+                                       const function<void(int, const ResultadoDijkstra&, int)>& callback) const {
+    int n = grafo.getNumVertices();
+    for (int origem : origens) {
+        if (origem < 1 || origem > n) {
+            throw invalid_argument("Vértice " + to_string(origem) + " inválido");
+        }
+    }
+
+    int total = origens.size();
+    int threads = min(numThreads, max(total, 1));
+
+    atomic<int> proxima(0);
+    exception_ptr erro = nullptr;
+    mutex mutexErro;
+
+    auto trabalhar = [&](int idThread) {
+        try {
+            unique_ptr<IDijkstraStrategy> strategy = fabrica();
+            ResultadoDijkstra resultado;
+
+            while (true) {
+                int i = proxima.fetch_add(1, memory_order_relaxed);
+                if (i >= total) break;
+
+                Dijkstra::executarEm(grafo, origens[i], *strategy, resultado);
+                callback(i, resultado, idThread);
+            }
+        } catch (...) {
+            lock_guard<mutex> trava(mutexErro);
+            if (!erro) erro = current_exception();
+            proxima.store(total); // interrompe as demais threads
+        }
+    };
+
+    vector<thread> trabalhadores;
+    for (int t = 1; t < threads; t++) {
+        trabalhadores.emplace_back(trabalhar, t);
+    }
+    trabalhar(0);
+
+    for (auto& t : trabalhadores) {
+        t.join();
+    }
+
+    if (erro) {
+        rethrow_exception(erro);
+    }
+}
+
+void DijkstraParalelo::executar(const IGrafoPeso& grafo, const vector<int>& origens,
+                                const CallbackResultadoDijkstra& callback) const {
+    executarIndices(grafo, origens, [&](int, const ResultadoDijkstra& resultado, int idThread) {
+        callback(resultado, idThread);
+    });
+}
+
+vector<ResumoOrigem> DijkstraParalelo::calcularResumos(const IGrafoPeso& grafo,
+                                                       const vector<int>& origens) const {
+    vector<ResumoOrigem> resumos(origens.size());
+
+    // Cada posição é escrita por uma única thread: não há disputa
+    executarIndices(grafo, origens, [&](int i, const ResultadoDijkstra& resultado, int) {
+        ResumoOrigem& resumo = resumos[i];
+        resumo = {resultado.origem, 0.0, 0.0, 0, 0.0};
+
+        for (double d : resultado.distancias) {
+            if (d == INF) continue;
+            resumo.alcancados++;
+            resumo.somaDistancias += d;
+            resumo.excentricidade = max(resumo.excentricidade, d);
+        }
+
+        if (resumo.somaDistancias > 0) {
+            resumo.proximidade = (resumo.alcancados - 1) / resumo.somaDistancias;
+        }
+    });
+
+    return resumos;
+}
+
+int DijkstraParalelo::getNumThreads() const {
+    return numThreads;
+}
@@ -0,0 +1,52 @@
+#ifndef DIJKSTRA_PARALELO_H
+#define DIJKSTRA_PARALELO_H
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include "../representacao_leitura/grafo_peso_interface.h"
+#include "dijkstra.h"
+using namespace std;
+
+// Resumo de uma origem, calculado sem guardar o vetor de distâncias
+struct ResumoOrigem {
+    int origem;             // base 1
+    double excentricidade;  // maior distância finita a partir da origem
+    double somaDistancias;  // soma das distâncias finitas
+    int alcancados;         // vértices alcançados, incluindo a origem
+    double proximidade;     // closeness: (alcancados - 1) / somaDistancias
+};
+
+typedef function<unique_ptr<IDijkstraStrategy>()> FabricaEstrategiaDijkstra;
+
+// Recebe o resultado de uma origem; é chamado em paralelo pelas threads de
+// trabalho e o resultado só é válido durante a chamada (o buffer é reutilizado)
+typedef function<void(const ResultadoDijkstra&, int idThread)> CallbackResultadoDijkstra;
+
+// Executa Dijkstras de fonte única para várias origens em paralelo.
+// Cada thread mantém sua própria estratégia e seu próprio ResultadoDijkstra,
+// reutilizados entre as origens que ela processa; as origens são distribuídas
+// dinamicamente por um contador atômico.
+class DijkstraParalelo {
+private:
+    int numThreads;
+    FabricaEstrategiaDijkstra fabrica;
+
+    // Callback recebe (posição da origem em origens, resultado, thread)
+    void executarIndices(const IGrafoPeso& grafo, const vector<int>& origens,
+                         const function<void(int, const ResultadoDijkstra&, int)>& callback) const;
+
+public:
+    // numThreads <= 0 usa todas as threads de hardware
+    DijkstraParalelo(int numThreads = 0, FabricaEstrategiaDijkstra fabrica = nullptr);
+
+    void executar(const IGrafoPeso& grafo, const vector<int>& origens,
+                  const CallbackResultadoDijkstra& callback) const;
+
+    // Redução por origem: memória O(threads * n) em vez de O(origens * n)
+    vector<ResumoOrigem> calcularResumos(const IGrafoPeso& grafo, const vector<int>& origens) const;
+
+    int getNumThreads() const;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef DIJKSTRA_TORNEIO_STRATEGY_H
+#define DIJKSTRA_TORNEIO_STRATEGY_H
+
+#include "dijkstra_strategy.h"
+#include "operacoes_simd.h"
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Vetor de chaves dividido em blocos de TAMANHO_BLOCO vértices, com uma
+// árvore de torneio sobre o mínimo de cada bloco. Atualizar uma chave custa
+// O(log(n / TAMANHO_BLOCO)) e recalcular um bloco é uma varredura vetorizada
+// de TAMANHO_BLOCO chaves, feita apenas quando o vencedor do bloco sai.
+class DijkstraTorneioStrategy : public IDijkstraStrategy {
+private:
+    static constexpr int TAMANHO_BLOCO = 64;
+
+    vector<double> chaves; // +infinito para vértices visitados ou não alcançados
+    vector<bool> visitado;
+    vector<int> arvore;    // nó i guarda o vértice vencedor da subárvore, ou -1
+    int n;
+    int folhas;            // potência de 2 >= número de blocos
+    int verticesVisitados;
+
+    double chave(int vertice) const {
+        return vertice == -1 ? numeric_limits<double>::infinity() : chaves[vertice];
+    }
+
+    // Em empate vence o lado esquerdo, isto é, o menor índice
+    int vencedor(int a, int b) const {
+        return chave(b) < chave(a) ? b : a;
+    }
+
+    void subir(int bloco) {
+        for (int i = (folhas + bloco) / 2; i >= 1; i /= 2) {
+            arvore[i] = vencedor(arvore[2 * i], arvore[2 * i + 1]);
+        }
+    }
+
+    void recalcularBloco(int bloco) {
+        int inicio = bloco * TAMANHO_BLOCO;
+        int tamanho = min(TAMANHO_BLOCO, n - inicio);
+        int indice = OperacoesSIMD::argmin(chaves.data() + inicio, tamanho);
+
+        arvore[folhas + bloco] = (indice == -1) ? -1 : inicio + indice;
+        subir(bloco);
+    }
+
+public:
+    void inicializar(int numVertices) override {
+        n = numVertices;
+        chaves.assign(n, numeric_limits<double>::infinity());
+        visitado.assign(n, false);
+        verticesVisitados = 0;
+
+        int numBlocos = (n + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO;
+        folhas = 1;
+        while (folhas < numBlocos) {
+            folhas *= 2;
+        }
+        arvore.assign(2 * folhas, -1);
+    }
+
+    void inserirOuAtualizar(int vertice, double distancia) override {
+        if (visitado[vertice]) {
+            return;
+        }
+
+        double anterior = chaves[vertice];
+        chaves[vertice] = distancia;
+
+        int bloco = vertice / TAMANHO_BLOCO;
+        int atual = arvore[folhas + bloco];
+
+        if (atual == vertice) {
+            // O vencedor só pode piorar num aumento de chave
+            if (distancia <= anterior) {
+                subir(bloco);
+            } else {
+                recalcularBloco(bloco);
+            }
+        } else if (distancia < chave(atual) || (distancia == chave(atual) && vertice < atual)) {
+            arvore[folhas + bloco] = vertice;
+            subir(bloco);
+        }
+    }
+
+    int extrairMinimo() override {
+        int minimo = arvore[1]; // raiz; com um só bloco, a própria folha
+
+        if (minimo != -1) {
+            marcarVisitado(minimo);
+        }
+
+        return minimo;
+    }
+
+    bool vazio() const override {
+        return verticesVisitados >= n;
+    }
+
+    void marcarVisitado(int vertice) override {
+        if (visitado[vertice]) {
+            return;
+        }
+
+        visitado[vertice] = true;
+        chaves[vertice] = numeric_limits<double>::infinity();
+        verticesVisitados++;
+
+        int bloco = vertice / TAMANHO_BLOCO;
+        if (arvore[folhas + bloco] == vertice) {
+            recalcularBloco(bloco);
+        }
+    }
+};
+
+#endif
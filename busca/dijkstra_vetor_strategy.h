@@ -2,64 +2,42 @@
 #define DIJKSTRA_VETOR_STRATEGY_H
 
 #include "dijkstra_strategy.h"
+#include "operacoes_simd.h"
 #include <limits>
 
 using namespace std;
 
 class DijkstraVetorStrategy : public IDijkstraStrategy {
 private:
-    vector<double> distancias;
+    // Vértices visitados ficam com chave +infinito: a busca do mínimo é uma
+    // única varredura vetorizada, sem consultar um vetor de visitados à parte
+    vector<double> chaves;
     vector<bool> visitado;
     int n;
-    int proximoMinimo; // Cache do próximo vértice com menor distância
     int verticesVisitados; // Contador para otimizar vazio()
 
-    void atualizarProximoMinimo() {
-        proximoMinimo = -1;
-        double menorDist = numeric_limits<double>::infinity();
-        
-        for (int v = 0; v < n; v++) {
-            if (!visitado[v] && distancias[v] < menorDist) {
-                menorDist = distancias[v];
-                proximoMinimo = v;
-            }
-        }
-    }
-
 public:
     void inicializar(int numVertices) override {
         n = numVertices;
-        distancias.assign(n, numeric_limits<double>::infinity());
+        chaves.assign(n, numeric_limits<double>::infinity());
         visitado.assign(n, false);
-        proximoMinimo = -1;
         verticesVisitados = 0; // Inicializar contador
     }
 
     void inserirOuAtualizar(int vertice, double distancia) override {
-        distancias[vertice] = distancia;
-        
-        // Se este vértice tem distância menor que o atual mínimo, atualize
-        if (proximoMinimo == -1 || 
-            (!visitado[vertice] && distancia < distancias[proximoMinimo])) {
-            proximoMinimo = vertice;
+        if (!visitado[vertice]) {
+            chaves[vertice] = distancia;
         }
     }
 
     int extrairMinimo() override {
-        // Se o cache está inválido ou o vértice já foi visitado, recalcular
-        if (proximoMinimo == -1 || visitado[proximoMinimo]) {
-            atualizarProximoMinimo();
-        }
+        int minimo = OperacoesSIMD::argmin(chaves.data(), n);
 
-        if (proximoMinimo != -1) {
-            visitado[proximoMinimo] = true;
-            verticesVisitados++; // Incrementar contador
-            int resultado = proximoMinimo;
-            proximoMinimo = -1; // Invalidar cache para forçar recálculo na próxima chamada
-            return resultado;
+        if (minimo != -1) {
+            marcarVisitado(minimo);
         }
 
-        return -1;
+        return minimo;
     }
 
     bool vazio() const override {
@@ -70,12 +48,10 @@ public:
     void marcarVisitado(int vertice) override {
         if (!visitado[vertice]) {
             visitado[vertice] = true;
+            chaves[vertice] = numeric_limits<double>::infinity();
             verticesVisitados++; // Incrementar contador
-            if (proximoMinimo == vertice) {
-                proximoMinimo = -1; // Invalidar cache
-            }
         }
     }
 };
 
-#endif
\ No newline at end of file
+#endif
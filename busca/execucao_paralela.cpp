@@ -0,0 +1,54 @@
+#include "execucao_paralela.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <vector>
+#include <algorithm>
+
+int ExecucaoParalela::resolverNumThreads(int numThreads) {
+    if (numThreads > 0) {
+        return numThreads;
+    }
+    unsigned int hw = thread::hardware_concurrency();
+    return hw > 0 ? static_cast<int>(hw) : 1;
+}
+
+void ExecucaoParalela::paraCadaLote(int n, int numThreads, int tamanhoLote,
+                                    const function<void(int, int, int)>& tarefa) {
+    int numLotes = (n + tamanhoLote - 1) / tamanhoLote;
+    int threads = min(numThreads, numLotes);
+    if (threads <= 1) {
+        if (n > 0) tarefa(0, n, 0);
+        return;
+    }
+
+    atomic<int> proximo(0);
+    exception_ptr erro = nullptr;
+    mutex mutexErro;
+    auto trabalhar = [&](int idThread) {
+        try {
+            for (int lote = proximo.fetch_add(1); lote < numLotes; lote = proximo.fetch_add(1)) {
+                int inicio = lote * tamanhoLote;
+                tarefa(inicio, min(n, inicio + tamanhoLote), idThread);
+            }
+        } catch (...) {
+            lock_guard<mutex> trava(mutexErro);
+            if (!erro) erro = current_exception();
+            proximo.store(numLotes); // as demais threads não pegam novos lotes
+        }
+    };
+
+    vector<thread> trabalhadores;
+    for (int t = 1; t < threads; t++) {
+        trabalhadores.emplace_back(trabalhar, t);
+    }
+    trabalhar(0);
+    for (auto& t : trabalhadores) {
+        t.join();
+    }
+
+    if (erro) {
+        rethrow_exception(erro);
+    }
+}
@@ -0,0 +1,23 @@
+#ifndef EXECUCAO_PARALELA_H
+#define EXECUCAO_PARALELA_H
+
+#include <functional>
+using namespace std;
+
+// Utilitários de paralelismo compartilhados pelos motores de busca e de
+// análise: número padrão de threads e divisão de um intervalo em lotes.
+class ExecucaoParalela {
+public:
+    // numThreads <= 0 vira o número de threads de hardware (1 se desconhecido)
+    static int resolverNumThreads(int numThreads);
+
+    // Executa tarefa(inicio, fim, thread) sobre lotes de tamanhoLote índices
+    // de [0, n). Os lotes são distribuídos dinamicamente entre até numThreads
+    // threads (a chamadora é a thread 0); com um lote só, roda na chamadora.
+    // A primeira exceção lançada por um lote interrompe a distribuição e é
+    // relançada na chamadora depois que todas as threads terminam.
+    static void paraCadaLote(int n, int numThreads, int tamanhoLote,
+                             const function<void(int, int, int)>& tarefa);
+};
+
+#endif
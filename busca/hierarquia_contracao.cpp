@@ -0,0 +1,518 @@
+#include "hierarquia_contracao.h"
+#include <iostream>
+#include <fstream>
+#include <queue>
+#include <chrono>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include "../representacao_leitura/lista_adjacencia_peso_adapter.h"
+#include "../representacao_leitura/assinatura_grafo.h"
+
+namespace {
+const char MAGICO_CH[4] = {'C', 'H', '0', '2'};
+const double INF_CH = numeric_limits<double>::infinity();
+
+// Limites de vértices fixados na busca de testemunhas; se estourar, o atalho
+// é considerado necessário (pode sobrar atalho, nunca faltar). A estimativa de
+// prioridade usa um limite menor, pois só precisa ordenar os vértices.
+const int LIMITE_TESTEMUNHA_CONTRACAO = 200;
+const int LIMITE_TESTEMUNHA_ESTIMATIVA = 40;
+
+// Vértices com grau restante acima deste limite não são contraídos: formam o
+// núcleo, onde a consulta vira um Dijkstra bidirecional comum. Em redes de
+// colaboração (hubs, núcleo denso) isso evita uma explosão de atalhos.
+const int GRAU_MAXIMO_CONTRACAO = 96;
+const int PRIORIDADE_NUCLEO = numeric_limits<int>::max();
+
+typedef priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> FilaMinima;
+
+uint64_t assinaturaPesos(const ListaAdjacenciaPeso& grafo) {
+    return calcularAssinatura(ListaAdjacenciaPesoAdapter(grafo));
+}
+
+// Estado mutável usado apenas durante a contração
+class Contrator {
+public:
+    int n;
+    vector<vector<ArestaCH>> adj; // grafo restante (vértices ainda não contraídos)
+    vector<double> dist;
+    vector<bool> alvo;
+    vector<int> tocados;
+
+    Contrator(const ListaAdjacenciaPeso& grafo) : n(grafo.getNumVertices()) {
+        adj.resize(n);
+        dist.assign(n, INF_CH);
+        alvo.assign(n, false);
+
+        const auto& L = grafo.getLista();
+        for (int u = 0; u < n; u++) {
+            for (const auto& [vizinho_1based, peso] : L[u]) {
+                int v = vizinho_1based - 1;
+                if (v != u) {
+                    inserirOuReduzir(u, v, peso, -1);
+                }
+            }
+        }
+    }
+
+    // Mantém uma única aresta por par, com o menor peso
+    void inserirOuReduzir(int u, int v, double peso, int meio) {
+        for (auto& aresta : adj[u]) {
+            if (aresta.alvo == v) {
+                if (peso < aresta.peso) {
+                    aresta.peso = peso;
+                    aresta.meio = meio;
+                }
+                return;
+            }
+        }
+        adj[u].push_back({v, peso, meio});
+    }
+
+    void remover(int u, int v) {
+        auto& lista = adj[u];
+        for (size_t i = 0; i < lista.size(); i++) {
+            if (lista[i].alvo == v) {
+                lista[i] = lista.back();
+                lista.pop_back();
+                return;
+            }
+        }
+    }
+
+    // Dijkstra local a partir de u ignorando o vértice excluido; para assim que
+    // todos os alvos forem fixados ou a distância passar do limite
+    void buscaTestemunha(int u, int excluido, const vector<int>& alvos, double limite, int maxFixados) {
+        for (int v : tocados) {
+            dist[v] = INF_CH;
+            alvo[v] = false;
+        }
+        tocados.clear();
+
+        int alvosRestantes = 0;
+        for (int w : alvos) {
+            if (!alvo[w]) {
+                alvo[w] = true;
+                alvosRestantes++;
+                tocados.push_back(w);
+            }
+        }
+
+        FilaMinima pq;
+        dist[u] = 0.0;
+        tocados.push_back(u);
+        pq.push({0.0, u});
+
+        int fixados = 0;
+        while (!pq.empty() && fixados < maxFixados && alvosRestantes > 0) {
+            auto [d, x] = pq.top();
+            pq.pop();
+
+            if (d > dist[x]) continue;
+            if (d > limite) break;
+            fixados++;
+
+            if (alvo[x]) {
+                alvo[x] = false;
+                alvosRestantes--;
+            }
+
+            // Não expande vértices de grau alto (hubs): percorrer suas listas
+            // domina o custo e, no pior caso, só gera atalhos a mais
+            if (x != u && static_cast<int>(adj[x].size()) > GRAU_MAXIMO_CONTRACAO) continue;
+
+            for (const auto& aresta : adj[x]) {
+                if (aresta.alvo == excluido) continue;
+                double nd = d + aresta.peso;
+                if (nd <= limite && nd < dist[aresta.alvo]) {
+                    tocados.push_back(aresta.alvo);
+                    dist[aresta.alvo] = nd;
+                    pq.push({nd, aresta.alvo});
+                }
+            }
+        }
+    }
+
+    // Conta (ou insere) os atalhos necessários para contrair v
+    int processarAtalhos(int v, bool inserir) {
+        const vector<ArestaCH> vizinhos = adj[v];
+        int atalhos = 0;
+        vector<int> alvos;
+
+        for (size_t i = 0; i + 1 < vizinhos.size(); i++) {
+            int u = vizinhos[i].alvo;
+
+            // Só os pares (i, j) com j > i precisam ser testados
+            double maiorPeso = 0.0;
+            alvos.clear();
+            for (size_t j = i + 1; j < vizinhos.size(); j++) {
+                maiorPeso = max(maiorPeso, vizinhos[j].peso);
+                alvos.push_back(vizinhos[j].alvo);
+            }
+
+            buscaTestemunha(u, v, alvos, vizinhos[i].peso + maiorPeso,
+                            inserir ? LIMITE_TESTEMUNHA_CONTRACAO : LIMITE_TESTEMUNHA_ESTIMATIVA);
+
+            for (size_t j = i + 1; j < vizinhos.size(); j++) {
+                int w = vizinhos[j].alvo;
+                double viaV = vizinhos[i].peso + vizinhos[j].peso;
+
+                if (dist[w] > viaV) {
+                    atalhos++;
+                    if (inserir) {
+                        inserirOuReduzir(u, w, viaV, v);
+                        inserirOuReduzir(w, u, viaV, v);
+                    }
+                }
+            }
+        }
+
+        return atalhos;
+    }
+};
+} // namespace
+
+HierarquiaContracao::HierarquiaContracao(int numVertices) : n(numVertices) {
+    numAtalhos = 0;
+    inicioNucleo = n;
+    assinaturaGrafo = 0;
+    tempoConstrucaoMs = 0.0;
+}
+
+void HierarquiaContracao::construir(const ListaAdjacenciaPeso& grafo) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    Contrator contrator(grafo);
+    nivel.assign(n, -1);
+    subida.assign(n, vector<ArestaCH>());
+    numAtalhos = 0;
+    assinaturaGrafo = assinaturaPesos(grafo);
+
+    // prioridade = diferença de arestas (atalhos - arestas removidas)
+    //              + vizinhos já contraídos (espalha a contração pelo grafo)
+    vector<int> vizinhosContraidos(n, 0);
+    vector<int> prioridade(n);
+
+    auto calcularPrioridade = [&](int v) {
+        if (static_cast<int>(contrator.adj[v].size()) > GRAU_MAXIMO_CONTRACAO) {
+            return PRIORIDADE_NUCLEO;
+        }
+        int atalhos = contrator.processarAtalhos(v, false);
+        return atalhos - static_cast<int>(contrator.adj[v].size()) + vizinhosContraidos[v];
+    };
+
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> fila;
+    for (int v = 0; v < n; v++) {
+        prioridade[v] = calcularPrioridade(v);
+        fila.push({prioridade[v], v});
+    }
+
+    int proximoNivel = 0;
+    while (!fila.empty()) {
+        auto [p, v] = fila.top();
+        fila.pop();
+
+        if (nivel[v] != -1 || p != prioridade[v]) continue;
+
+        // Atualização preguiçosa: recalcula e só contrai se ainda for o mínimo
+        int atual = calcularPrioridade(v);
+        if (!fila.empty() && atual > fila.top().first) {
+            prioridade[v] = atual;
+            fila.push({atual, v});
+            continue;
+        }
+
+        if (atual == PRIORIDADE_NUCLEO) {
+            break; // todos os vértices restantes ficam no núcleo
+        }
+
+        numAtalhos += contrator.processarAtalhos(v, true);
+
+        nivel[v] = proximoNivel++;
+        subida[v] = contrator.adj[v]; // vizinhos restantes têm nível maior
+
+        for (const auto& aresta : subida[v]) {
+            int u = aresta.alvo;
+            contrator.remover(u, v);
+            vizinhosContraidos[u]++;
+        }
+        contrator.adj[v].clear();
+        contrator.adj[v].shrink_to_fit();
+    }
+
+    // Núcleo: níveis mais altos, com todas as arestas restantes nos dois sentidos
+    inicioNucleo = proximoNivel;
+    for (int v = 0; v < n; v++) {
+        if (nivel[v] == -1) {
+            nivel[v] = proximoNivel++;
+            subida[v] = contrator.adj[v];
+        }
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoConstrucaoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+const ArestaCH& HierarquiaContracao::arestaEntre(int a, int b) const {
+    // Entre dois vértices do núcleo a aresta está guardada nos dois sentidos
+    bool ambosNoNucleo = nivel[a] >= inicioNucleo && nivel[b] >= inicioNucleo;
+    int baixo = (ambosNoNucleo || nivel[a] < nivel[b]) ? a : b;
+    int alto = (baixo == a) ? b : a;
+
+    for (const auto& aresta : subida[baixo]) {
+        if (aresta.alvo == alto) {
+            return aresta;
+        }
+    }
+    throw runtime_error("Hierarquia de contração inconsistente");
+}
+
+// Acrescenta ao caminho os vértices originais entre a (exclusivo) e b (inclusivo)
+void HierarquiaContracao::desempacotar(int a, int b, vector<int>& caminho) const {
+    vector<pair<int, int>> pilha;
+    pilha.push_back({a, b});
+
+    while (!pilha.empty()) {
+        auto [x, y] = pilha.back();
+        pilha.pop_back();
+
+        const ArestaCH& aresta = arestaEntre(x, y);
+        if (aresta.meio == -1) {
+            caminho.push_back(y + 1);
+        } else {
+            pilha.push_back({aresta.meio, y});
+            pilha.push_back({x, aresta.meio});
+        }
+    }
+}
+
+ResultadoConsultaCH HierarquiaContracao::consultar(int origem, int destino) const {
+    if (origem < 1 || origem > n || destino < 1 || destino > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+
+    if (static_cast<int>(distIda.size()) != n) {
+        distIda.assign(n, INF_CH);
+        distVolta.assign(n, INF_CH);
+        predIda.assign(n, -1);
+        predVolta.assign(n, -1);
+    }
+    for (int v : tocados) {
+        distIda[v] = INF_CH;
+        distVolta[v] = INF_CH;
+        predIda[v] = -1;
+        predVolta[v] = -1;
+    }
+    tocados.clear();
+
+    ResultadoConsultaCH resultado;
+    resultado.distancia = INF_CH;
+    resultado.verticesVisitados = 0;
+
+    int s = origem - 1;
+    int t = destino - 1;
+
+    FilaMinima filaIda, filaVolta;
+    distIda[s] = 0.0;
+    distVolta[t] = 0.0;
+    tocados.push_back(s);
+    tocados.push_back(t);
+    filaIda.push({0.0, s});
+    filaVolta.push({0.0, t});
+
+    double melhor = INF_CH;
+    int encontro = -1;
+
+    while (!filaIda.empty() || !filaVolta.empty()) {
+        double topoIda = filaIda.empty() ? INF_CH : filaIda.top().first;
+        double topoVolta = filaVolta.empty() ? INF_CH : filaVolta.top().first;
+
+        if (min(topoIda, topoVolta) >= melhor) break;
+
+        bool ida = topoIda <= topoVolta;
+        FilaMinima& fila = ida ? filaIda : filaVolta;
+        vector<double>& dist = ida ? distIda : distVolta;
+        vector<int>& pred = ida ? predIda : predVolta;
+        const vector<double>& distOutra = ida ? distVolta : distIda;
+
+        auto [d, u] = fila.top();
+        fila.pop();
+
+        if (d > dist[u]) continue;
+        resultado.verticesVisitados++;
+
+        if (distOutra[u] != INF_CH && d + distOutra[u] < melhor) {
+            melhor = d + distOutra[u];
+            encontro = u;
+        }
+
+        for (const auto& aresta : subida[u]) {
+            double nd = d + aresta.peso;
+            if (nd < dist[aresta.alvo]) {
+                if (distIda[aresta.alvo] == INF_CH && distVolta[aresta.alvo] == INF_CH) {
+                    tocados.push_back(aresta.alvo);
+                }
+                dist[aresta.alvo] = nd;
+                pred[aresta.alvo] = u;
+                fila.push({nd, aresta.alvo});
+            }
+        }
+    }
+
+    if (encontro == -1) {
+        return resultado;
+    }
+
+    resultado.distancia = melhor;
+
+    // Trecho origem -> encontro (busca de ida) e encontro -> destino (busca de volta)
+    vector<int> cadeia;
+    for (int v = encontro; v != -1; v = predIda[v]) {
+        cadeia.push_back(v);
+    }
+    reverse(cadeia.begin(), cadeia.end());
+
+    resultado.caminho.push_back(s + 1);
+    for (size_t i = 1; i < cadeia.size(); i++) {
+        desempacotar(cadeia[i - 1], cadeia[i], resultado.caminho);
+    }
+    for (int v = encontro; predVolta[v] != -1; v = predVolta[v]) {
+        desempacotar(v, predVolta[v], resultado.caminho);
+    }
+
+    return resultado;
+}
+
+void HierarquiaContracao::salvarEmArquivo(const string& nomeArquivo) const {
+    ofstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        throw runtime_error("Erro ao criar arquivo da hierarquia");
+    }
+
+    int32_t numVertices = n;
+    arquivo.write(MAGICO_CH, sizeof(MAGICO_CH));
+    arquivo.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+    arquivo.write(reinterpret_cast<const char*>(&assinaturaGrafo), sizeof(assinaturaGrafo));
+    arquivo.write(reinterpret_cast<const char*>(&numAtalhos), sizeof(numAtalhos));
+    int32_t nucleo = inicioNucleo;
+    arquivo.write(reinterpret_cast<const char*>(&nucleo), sizeof(nucleo));
+
+    for (int v = 0; v < n; v++) {
+        int32_t nivelV = nivel[v];
+        int32_t grau = subida[v].size();
+        arquivo.write(reinterpret_cast<const char*>(&nivelV), sizeof(nivelV));
+        arquivo.write(reinterpret_cast<const char*>(&grau), sizeof(grau));
+
+        for (const auto& aresta : subida[v]) {
+            int32_t alvo = aresta.alvo;
+            int32_t meio = aresta.meio;
+            arquivo.write(reinterpret_cast<const char*>(&alvo), sizeof(alvo));
+            arquivo.write(reinterpret_cast<const char*>(&aresta.peso), sizeof(aresta.peso));
+            arquivo.write(reinterpret_cast<const char*>(&meio), sizeof(meio));
+        }
+    }
+
+    if (!arquivo) {
+        throw runtime_error("Erro ao gravar arquivo da hierarquia");
+    }
+}
+
+bool HierarquiaContracao::carregarDeArquivo(const string& nomeArquivo, const ListaAdjacenciaPeso& grafo) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        return false;
+    }
+
+    char magico[4];
+    int32_t numVertices = 0;
+    uint64_t assinatura = 0;
+    long long atalhos = 0;
+
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&numVertices), sizeof(numVertices));
+    arquivo.read(reinterpret_cast<char*>(&assinatura), sizeof(assinatura));
+    arquivo.read(reinterpret_cast<char*>(&atalhos), sizeof(atalhos));
+    int32_t nucleo = 0;
+    arquivo.read(reinterpret_cast<char*>(&nucleo), sizeof(nucleo));
+
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_CH) || numVertices != n ||
+        nucleo < 0 || nucleo > n || assinatura != assinaturaPesos(grafo)) {
+        return false;
+    }
+
+    vector<int> novoNivel(n);
+    vector<vector<ArestaCH>> novaSubida(n);
+
+    for (int v = 0; v < n; v++) {
+        int32_t nivelV = 0;
+        int32_t grau = 0;
+        arquivo.read(reinterpret_cast<char*>(&nivelV), sizeof(nivelV));
+        arquivo.read(reinterpret_cast<char*>(&grau), sizeof(grau));
+        if (!arquivo || grau < 0 || grau > n) return false;
+
+        novoNivel[v] = nivelV;
+        novaSubida[v].resize(grau);
+        for (auto& aresta : novaSubida[v]) {
+            int32_t alvo = 0;
+            int32_t meio = 0;
+            arquivo.read(reinterpret_cast<char*>(&alvo), sizeof(alvo));
+            arquivo.read(reinterpret_cast<char*>(&aresta.peso), sizeof(aresta.peso));
+            arquivo.read(reinterpret_cast<char*>(&meio), sizeof(meio));
+            if (alvo < 0 || alvo >= n || meio < -1 || meio >= n) return false;
+            aresta.alvo = alvo;
+            aresta.meio = meio;
+        }
+    }
+
+    if (!arquivo) {
+        return false;
+    }
+
+    nivel = move(novoNivel);
+    subida = move(novaSubida);
+    numAtalhos = atalhos;
+    inicioNucleo = nucleo;
+    assinaturaGrafo = assinatura;
+    tempoConstrucaoMs = 0.0;
+    tocados.clear();
+    distIda.clear();
+    return true;
+}
+
+string HierarquiaContracao::caminhoArquivoHierarquia(const string& caminhoGrafo) {
+    return caminhoGrafo + ".ch";
+}
+
+long long HierarquiaContracao::getNumAtalhos() const {
+    return numAtalhos;
+}
+
+double HierarquiaContracao::getTempoConstrucaoMs() const {
+    return tempoConstrucaoMs;
+}
+
+size_t HierarquiaContracao::getMemoriaBytes() const {
+    size_t total = nivel.size() * sizeof(int);
+    for (const auto& arestas : subida) {
+        total += sizeof(arestas) + arestas.size() * sizeof(ArestaCH);
+    }
+    return total;
+}
+
+void HierarquiaContracao::imprimirResumo() const {
+    long long arestasSubida = 0;
+    for (const auto& arestas : subida) {
+        arestasSubida += arestas.size();
+    }
+
+    cout << "Hierarquia de contração (" << n << " vértices):\n";
+    cout << "• Arestas no grafo de subida: " << arestasSubida << "\n";
+    cout << "• Atalhos inseridos: " << numAtalhos << "\n";
+    cout << "• Vértices no núcleo não contraído: " << (n - inicioNucleo) << "\n";
+    cout << fixed << setprecision(3);
+    cout << "• Tempo de construção: " << tempoConstrucaoMs << " ms\n";
+    cout << "• Memória: " << setprecision(2) << getMemoriaBytes() / (1024.0 * 1024.0) << " MB\n";
+}
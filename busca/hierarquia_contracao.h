@@ -0,0 +1,74 @@
+#ifndef HIERARQUIA_CONTRACAO_H
+#define HIERARQUIA_CONTRACAO_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "../representacao_leitura/lista_adjacencia_peso.h"
+using namespace std;
+
+// Aresta do grafo de busca; meio != -1 indica um atalho que substitui
+// o caminho alvo-meio-origem
+struct ArestaCH {
+    int alvo;
+    double peso;
+    int meio;
+};
+
+struct ResultadoConsultaCH {
+    double distancia;
+    vector<int> caminho;    // vértices originais em base 1, da origem ao destino
+    int verticesVisitados;  // vértices retirados das duas filas de prioridade
+};
+
+// Hierarquia de contração (contraction hierarchies) sobre ListaAdjacenciaPeso.
+// Os vértices são contraídos em ordem de diferença de arestas; cada vértice
+// guarda apenas as arestas para vértices de nível mais alto (grafo de subida).
+// Como o grafo é não direcionado, o grafo de descida é o mesmo grafo de subida
+// percorrido no sentido inverso, então as duas buscas da consulta usam "subida".
+// Vértices de grau muito alto ficam num núcleo não contraído (core-CH).
+class HierarquiaContracao {
+private:
+    int n;
+    vector<int> nivel;                 // posição de cada vértice na ordem de contração
+    vector<vector<ArestaCH>> subida;   // arestas para vértices de nível maior
+    long long numAtalhos;
+    int inicioNucleo;                  // vértices com nivel >= inicioNucleo não foram contraídos
+    uint64_t assinaturaGrafo;          // vértices, vizinhos e pesos; valida o arquivo salvo
+    double tempoConstrucaoMs;
+
+    // Buffers reutilizados entre consultas (consultar não é thread-safe)
+    mutable vector<double> distIda, distVolta;
+    mutable vector<int> predIda, predVolta;
+    mutable vector<int> tocados;
+
+    const ArestaCH& arestaEntre(int a, int b) const;
+    void desempacotar(int a, int b, vector<int>& caminho) const;
+
+public:
+    HierarquiaContracao(int numVertices);
+
+    void construir(const ListaAdjacenciaPeso& grafo);
+
+    // origem e destino em base 1
+    ResultadoConsultaCH consultar(int origem, int destino) const;
+
+    void salvarEmArquivo(const string& nomeArquivo) const;
+
+    // Retorna false se o arquivo não existir ou não corresponder ao grafo
+    bool carregarDeArquivo(const string& nomeArquivo, const ListaAdjacenciaPeso& grafo);
+
+    // Arquivo da hierarquia gravado ao lado do arquivo do grafo
+    static string caminhoArquivoHierarquia(const string& caminhoGrafo);
+
+    long long getNumAtalhos() const;
+
+    double getTempoConstrucaoMs() const;
+
+    size_t getMemoriaBytes() const;
+
+    void imprimirResumo() const;
+};
+
+#endif
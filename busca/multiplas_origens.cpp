@@ -0,0 +1,154 @@
+#include "multiplas_origens.h"
+#include <queue>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+// Zera as distâncias das origens; devolve as origens distintas em base 0
+vector<int> semearOrigens(int n, const vector<int>& origens, ResultadoMultiplasOrigens& resultado) {
+    resultado.distancias.assign(n, INF);
+    resultado.predecessores.assign(n, -1);
+    resultado.origemMaisProxima.assign(n, -1);
+
+    vector<int> sementes;
+    for (int origem : origens) {
+        if (origem < 1 || origem > n) {
+            throw invalid_argument("Vértice inválido");
+        }
+        int s = origem - 1;
+        if (resultado.origemMaisProxima[s] != -1) continue;
+        resultado.distancias[s] = 0;
+        resultado.origemMaisProxima[s] = origem;
+        sementes.push_back(s);
+    }
+    return sementes;
+}
+
+vector<bool> marcarDestinos(int n, const vector<int>& destinos) {
+    vector<bool> ehDestino(n, false);
+    for (int destino : destinos) {
+        if (destino < 1 || destino > n) {
+            throw invalid_argument("Vértice inválido");
+        }
+        ehDestino[destino - 1] = true;
+    }
+    return ehDestino;
+}
+
+// Dijkstra semeado; com ehDestino, para no primeiro destino fechado e o devolve
+int executarDijkstra(const IGrafoPeso& grafo, const vector<int>& origens, ResultadoMultiplasOrigens& resultado,
+                     const vector<bool>* ehDestino, int& fechados) {
+    int n = grafo.getNumVertices();
+    vector<int> sementes = semearOrigens(n, origens, resultado);
+    vector<double>& dist = resultado.distancias;
+
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+    for (int s : sementes) {
+        pq.push({0.0, s});
+    }
+
+    fechados = 0;
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+
+        if (d != dist[u]) continue;
+        fechados++;
+
+        if (ehDestino && (*ehDestino)[u]) {
+            return u;
+        }
+
+        for (const auto& [v, peso] : grafo.getVizinhosComPeso(u)) {
+            if (dist[u] + peso < dist[v]) {
+                dist[v] = dist[u] + peso;
+                resultado.predecessores[v] = u + 1;
+                resultado.origemMaisProxima[v] = resultado.origemMaisProxima[u];
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    return -1;
+}
+
+// BFS semeada; com ehDestino, para no primeiro destino descoberto (a fila
+// avança nível a nível, então ele já está na menor distância)
+int executarBFS(const IGrafo& grafo, const vector<int>& origens, ResultadoMultiplasOrigens& resultado,
+                const vector<bool>* ehDestino, int& fechados) {
+    int n = grafo.getNumVertices();
+    vector<int> fila = semearOrigens(n, origens, resultado);
+    vector<double>& dist = resultado.distancias;
+
+    fechados = 0;
+    if (ehDestino) {
+        for (int s : fila) {
+            if ((*ehDestino)[s]) return s;
+        }
+    }
+
+    for (size_t i = 0; i < fila.size(); i++) {
+        int u = fila[i];
+        fechados++;
+
+        for (int v : grafo.getVizinhos(u)) {
+            if (dist[v] != INF) continue;
+            dist[v] = dist[u] + 1;
+            resultado.predecessores[v] = u + 1;
+            resultado.origemMaisProxima[v] = resultado.origemMaisProxima[u];
+            if (ehDestino && (*ehDestino)[v]) {
+                return v;
+            }
+            fila.push_back(v);
+        }
+    }
+    return -1;
+}
+
+ResultadoEntreConjuntos montarResposta(const ResultadoMultiplasOrigens& busca, int alcancado, int fechados) {
+    ResultadoEntreConjuntos resposta{INF, -1, -1, {}, fechados};
+    if (alcancado == -1) {
+        return resposta;
+    }
+
+    resposta.distancia = busca.distancias[alcancado];
+    resposta.origem = busca.origemMaisProxima[alcancado];
+    resposta.destino = alcancado + 1;
+    for (int atual = alcancado + 1; atual != -1; atual = busca.predecessores[atual - 1]) {
+        resposta.caminho.push_back(atual);
+    }
+    reverse(resposta.caminho.begin(), resposta.caminho.end());
+    return resposta;
+}
+} // namespace
+
+ResultadoMultiplasOrigens MultiplasOrigens::dijkstra(const IGrafoPeso& grafo, const vector<int>& origens) {
+    ResultadoMultiplasOrigens resultado;
+    int fechados;
+    executarDijkstra(grafo, origens, resultado, nullptr, fechados);
+    return resultado;
+}
+
+ResultadoMultiplasOrigens MultiplasOrigens::bfs(const IGrafo& grafo, const vector<int>& origens) {
+    ResultadoMultiplasOrigens resultado;
+    int fechados;
+    executarBFS(grafo, origens, resultado, nullptr, fechados);
+    return resultado;
+}
+
+ResultadoEntreConjuntos MultiplasOrigens::dijkstraEntreConjuntos(const IGrafoPeso& grafo, const vector<int>& origens,
+                                                                 const vector<int>& destinos) {
+    vector<bool> ehDestino = marcarDestinos(grafo.getNumVertices(), destinos);
+    ResultadoMultiplasOrigens busca;
+    int fechados;
+    int alcancado = executarDijkstra(grafo, origens, busca, &ehDestino, fechados);
+    return montarResposta(busca, alcancado, fechados);
+}
+
+ResultadoEntreConjuntos MultiplasOrigens::bfsEntreConjuntos(const IGrafo& grafo, const vector<int>& origens,
+                                                            const vector<int>& destinos) {
+    vector<bool> ehDestino = marcarDestinos(grafo.getNumVertices(), destinos);
+    ResultadoMultiplasOrigens busca;
+    int fechados;
+    int alcancado = executarBFS(grafo, origens, busca, &ehDestino, fechados);
+    return montarResposta(busca, alcancado, fechados);
+}
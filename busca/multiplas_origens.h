@@ -0,0 +1,43 @@
+#ifndef MULTIPLAS_ORIGENS_H
+#define MULTIPLAS_ORIGENS_H
+
+#include <vector>
+#include "../representacao_leitura/grafo_interface.h"
+#include "../representacao_leitura/grafo_peso_interface.h"
+#include "dijkstra.h"
+using namespace std;
+
+struct ResultadoMultiplasOrigens {
+    vector<double> distancias;     // até a origem mais próxima; INF se inalcançável
+    vector<int> predecessores;     // base 1, -1 nas origens e nos inalcançáveis
+    vector<int> origemMaisProxima; // base 1, -1 se inalcançável
+};
+
+struct ResultadoEntreConjuntos {
+    double distancia;       // INF se nenhum destino for alcançável
+    int origem;             // base 1, -1 se não houver caminho
+    int destino;            // base 1, -1 se não houver caminho
+    vector<int> caminho;    // de origem até destino, base 1
+    int verticesFechados;   // vértices retirados da fila até a parada
+};
+
+// Buscas a partir de um conjunto de origens, todas com distância 0, como se
+// houvesse uma super-origem virtual ligada a cada uma por aresta de peso 0.
+// Uma única execução rotula cada vértice com a origem mais próxima; na
+// consulta entre conjuntos a busca para no primeiro destino fechado.
+// Vértices em base 1; origens repetidas são ignoradas.
+class MultiplasOrigens {
+public:
+    static ResultadoMultiplasOrigens dijkstra(const IGrafoPeso& grafo, const vector<int>& origens);
+
+    // Distâncias em número de arestas
+    static ResultadoMultiplasOrigens bfs(const IGrafo& grafo, const vector<int>& origens);
+
+    static ResultadoEntreConjuntos dijkstraEntreConjuntos(const IGrafoPeso& grafo, const vector<int>& origens,
+                                                          const vector<int>& destinos);
+
+    static ResultadoEntreConjuntos bfsEntreConjuntos(const IGrafo& grafo, const vector<int>& origens,
+                                                     const vector<int>& destinos);
+};
+
+#endif
@@ -0,0 +1,430 @@
+#include "operacoes_simd.h"
+#include <limits>
+#include <cstddef>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define OPERACOES_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+const double INFINITO = numeric_limits<double>::infinity();
+
+typedef int (*FuncaoArgmin)(const double*, int);
+typedef void (*FuncaoRelaxar)(const double*, double, double*, double*, int*, int, int);
+typedef void (*FuncaoMinPlus)(float*, const float*, const float*, int, int);
+typedef void (*FuncaoMaximoBytes)(uint8_t*, const uint8_t*, int);
+typedef int (*FuncaoIntersecao)(const int*, int, const int*, int, int*);
+
+void maximoBytesEscalar(uint8_t* destino, const uint8_t* origem, int inicio, int n) {
+    for (int i = inicio; i < n; i++) {
+        if (origem[i] > destino[i]) destino[i] = origem[i];
+    }
+}
+
+// Intercalação a partir de a[i] e b[j]; continua gravando em saida[k]
+int intersecaoEscalar(const int* a, int i, int na, const int* b, int j, int nb, int* saida, int k) {
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            saida[k++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return k;
+}
+
+void relaxarEscalar(const double* pesos, double base, double* dist,
+                    double* chaves, int* pred, int predecessor, int inicio, int n) {
+    for (int j = inicio; j < n; j++) {
+        double nova = base + pesos[j];
+        if (nova < dist[j]) {
+            dist[j] = nova;
+            chaves[j] = nova;
+            pred[j] = predecessor;
+        }
+    }
+}
+
+#ifdef OPERACOES_SIMD_X86
+
+int primeiroIgual(const double* v, int inicio, int n, double alvo) {
+    for (int i = inicio; i < n; i++) {
+        if (v[i] == alvo) return i;
+    }
+    return -1;
+}
+
+// Duas passadas: redução do mínimo com quatro acumuladores independentes e
+// depois a busca do primeiro índice igual ao mínimo, que termina cedo.
+__attribute__((target("avx2")))
+int argminAVX2(const double* v, int n) {
+    __m256d m0 = _mm256_set1_pd(INFINITO), m1 = m0, m2 = m0, m3 = m0;
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        m0 = _mm256_min_pd(m0, _mm256_loadu_pd(v + i));
+        m1 = _mm256_min_pd(m1, _mm256_loadu_pd(v + i + 4));
+        m2 = _mm256_min_pd(m2, _mm256_loadu_pd(v + i + 8));
+        m3 = _mm256_min_pd(m3, _mm256_loadu_pd(v + i + 12));
+    }
+    for (; i + 4 <= n; i += 4) {
+        m0 = _mm256_min_pd(m0, _mm256_loadu_pd(v + i));
+    }
+    m0 = _mm256_min_pd(_mm256_min_pd(m0, m1), _mm256_min_pd(m2, m3));
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, m0);
+    double menor = lanes[0];
+    for (int k = 1; k < 4; k++) {
+        if (lanes[k] < menor) menor = lanes[k];
+    }
+    for (; i < n; i++) {
+        if (v[i] < menor) menor = v[i];
+    }
+
+    if (menor == INFINITO) return -1;
+
+    __m256d alvo = _mm256_set1_pd(menor);
+    int j = 0;
+    for (; j + 4 <= n; j += 4) {
+        int mascara = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(v + j), alvo, _CMP_EQ_OQ));
+        if (mascara != 0) {
+            return j + __builtin_ctz(mascara);
+        }
+    }
+    return primeiroIgual(v, j, n, menor);
+}
+
+int argminSSE2(const double* v, int n) {
+    __m128d m0 = _mm_set1_pd(INFINITO), m1 = m0, m2 = m0, m3 = m0;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        m0 = _mm_min_pd(m0, _mm_loadu_pd(v + i));
+        m1 = _mm_min_pd(m1, _mm_loadu_pd(v + i + 2));
+        m2 = _mm_min_pd(m2, _mm_loadu_pd(v + i + 4));
+        m3 = _mm_min_pd(m3, _mm_loadu_pd(v + i + 6));
+    }
+    for (; i + 2 <= n; i += 2) {
+        m0 = _mm_min_pd(m0, _mm_loadu_pd(v + i));
+    }
+    m0 = _mm_min_pd(_mm_min_pd(m0, m1), _mm_min_pd(m2, m3));
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, m0);
+    double menor = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+    for (; i < n; i++) {
+        if (v[i] < menor) menor = v[i];
+    }
+
+    if (menor == INFINITO) return -1;
+
+    __m128d alvo = _mm_set1_pd(menor);
+    int j = 0;
+    for (; j + 2 <= n; j += 2) {
+        int mascara = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(v + j), alvo));
+        if (mascara != 0) {
+            return j + __builtin_ctz(mascara);
+        }
+    }
+    return primeiroIgual(v, j, n, menor);
+}
+
+// Os predecessores são inteiros: a máscara da comparação decide quais
+// posições do bloco recebem o novo predecessor
+__attribute__((target("avx2")))
+void relaxarAVX2(const double* pesos, double base, double* dist,
+                 double* chaves, int* pred, int predecessor, int n) {
+    __m256d vbase = _mm256_set1_pd(base);
+    int j = 0;
+    for (; j + 4 <= n; j += 4) {
+        __m256d nova = _mm256_add_pd(vbase, _mm256_loadu_pd(pesos + j));
+        __m256d atual = _mm256_loadu_pd(dist + j);
+        __m256d melhora = _mm256_cmp_pd(nova, atual, _CMP_LT_OQ);
+        int mascara = _mm256_movemask_pd(melhora);
+        if (mascara == 0) continue;
+
+        _mm256_storeu_pd(dist + j, _mm256_blendv_pd(atual, nova, melhora));
+        _mm256_storeu_pd(chaves + j, _mm256_blendv_pd(_mm256_loadu_pd(chaves + j), nova, melhora));
+        while (mascara != 0) {
+            pred[j + __builtin_ctz(mascara)] = predecessor;
+            mascara &= mascara - 1;
+        }
+    }
+    relaxarEscalar(pesos, base, dist, chaves, pred, predecessor, j, n);
+}
+
+void relaxarSSE2(const double* pesos, double base, double* dist,
+                 double* chaves, int* pred, int predecessor, int n) {
+    __m128d vbase = _mm_set1_pd(base);
+    int j = 0;
+    for (; j + 2 <= n; j += 2) {
+        __m128d nova = _mm_add_pd(vbase, _mm_loadu_pd(pesos + j));
+        __m128d atual = _mm_loadu_pd(dist + j);
+        __m128d melhora = _mm_cmplt_pd(nova, atual);
+        int mascara = _mm_movemask_pd(melhora);
+        if (mascara == 0) continue;
+
+        // blend do SSE2: (melhora & nova) | (~melhora & atual)
+        _mm_storeu_pd(dist + j, _mm_or_pd(_mm_and_pd(melhora, nova), _mm_andnot_pd(melhora, atual)));
+        __m128d chave = _mm_loadu_pd(chaves + j);
+        _mm_storeu_pd(chaves + j, _mm_or_pd(_mm_and_pd(melhora, nova), _mm_andnot_pd(melhora, chave)));
+        if (mascara & 1) pred[j] = predecessor;
+        if (mascara & 2) pred[j + 1] = predecessor;
+    }
+    relaxarEscalar(pesos, base, dist, chaves, pred, predecessor, j, n);
+}
+
+// As colunas que não completam um vetor são tratadas na mesma iteração (k, i),
+// preservando a ordem do Floyd-Warshall quando C coincide com A ou B
+__attribute__((target("avx2")))
+void minPlusAVX2(float* C, const float* A, const float* B, int tamanho, int passo) {
+    int colunasVetor = tamanho - tamanho % 8;
+    for (int k = 0; k < tamanho; k++) {
+        const float* linhaB = B + static_cast<size_t>(k) * passo;
+        for (int i = 0; i < tamanho; i++) {
+            float a = A[static_cast<size_t>(i) * passo + k];
+            if (a == numeric_limits<float>::infinity()) continue;
+
+            __m256 va = _mm256_set1_ps(a);
+            float* linhaC = C + static_cast<size_t>(i) * passo;
+            for (int j = 0; j < colunasVetor; j += 8) {
+                __m256 nova = _mm256_add_ps(va, _mm256_loadu_ps(linhaB + j));
+                _mm256_storeu_ps(linhaC + j, _mm256_min_ps(_mm256_loadu_ps(linhaC + j), nova));
+            }
+            for (int j = colunasVetor; j < tamanho; j++) {
+                float nova = a + linhaB[j];
+                if (nova < linhaC[j]) linhaC[j] = nova;
+            }
+        }
+    }
+}
+
+void minPlusSSE2(float* C, const float* A, const float* B, int tamanho, int passo) {
+    int colunasVetor = tamanho - tamanho % 4;
+    for (int k = 0; k < tamanho; k++) {
+        const float* linhaB = B + static_cast<size_t>(k) * passo;
+        for (int i = 0; i < tamanho; i++) {
+            float a = A[static_cast<size_t>(i) * passo + k];
+            if (a == numeric_limits<float>::infinity()) continue;
+
+            __m128 va = _mm_set1_ps(a);
+            float* linhaC = C + static_cast<size_t>(i) * passo;
+            for (int j = 0; j < colunasVetor; j += 4) {
+                __m128 nova = _mm_add_ps(va, _mm_loadu_ps(linhaB + j));
+                _mm_storeu_ps(linhaC + j, _mm_min_ps(_mm_loadu_ps(linhaC + j), nova));
+            }
+            for (int j = colunasVetor; j < tamanho; j++) {
+                float nova = a + linhaB[j];
+                if (nova < linhaC[j]) linhaC[j] = nova;
+            }
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void maximoBytesAVX2(uint8_t* destino, const uint8_t* origem, int n) {
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destino + i));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origem + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destino + i), _mm256_max_epu8(d, o));
+    }
+    maximoBytesEscalar(destino, origem, i, n);
+}
+
+void maximoBytesSSE2(uint8_t* destino, const uint8_t* origem, int n) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destino + i));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origem + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destino + i), _mm_max_epu8(d, o));
+    }
+    maximoBytesEscalar(destino, origem, i, n);
+}
+
+__attribute__((target("avx2")))
+int intersecaoAVX2(const int* a, int na, const int* b, int nb, int* saida) {
+    const __m256i rotacao = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    int i = 0, j = 0, k = 0;
+    while (i + 8 <= na && j + 8 <= nb) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i iguais = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; r++) {
+            vb = _mm256_permutevar8x32_epi32(vb, rotacao);
+            iguais = _mm256_or_si256(iguais, _mm256_cmpeq_epi32(va, vb));
+        }
+
+        int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(iguais));
+        while (mascara != 0) {
+            saida[k++] = a[i + __builtin_ctz(mascara)];
+            mascara &= mascara - 1;
+        }
+
+        int maiorA = a[i + 7], maiorB = b[j + 7];
+        if (maiorA <= maiorB) i += 8;
+        if (maiorB <= maiorA) j += 8;
+    }
+    return intersecaoEscalar(a, i, na, b, j, nb, saida, k);
+}
+
+int intersecaoSSE2(const int* a, int na, const int* b, int nb, int* saida) {
+    int i = 0, j = 0, k = 0;
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i iguais = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E)),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93))));
+
+        int mascara = _mm_movemask_ps(_mm_castsi128_ps(iguais));
+        while (mascara != 0) {
+            saida[k++] = a[i + __builtin_ctz(mascara)];
+            mascara &= mascara - 1;
+        }
+
+        int maiorA = a[i + 3], maiorB = b[j + 3];
+        if (maiorA <= maiorB) i += 4;
+        if (maiorB <= maiorA) j += 4;
+    }
+    return intersecaoEscalar(a, i, na, b, j, nb, saida, k);
+}
+
+FuncaoIntersecao escolherIntersecao() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return intersecaoAVX2;
+    return intersecaoSSE2;
+}
+
+FuncaoMaximoBytes escolherMaximoBytes() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return maximoBytesAVX2;
+    return maximoBytesSSE2;
+}
+
+FuncaoMinPlus escolherMinPlus() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return minPlusAVX2;
+    return minPlusSSE2;
+}
+
+FuncaoRelaxar escolherRelaxar() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return relaxarAVX2;
+    return relaxarSSE2;
+}
+
+FuncaoArgmin escolherArgmin() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return argminAVX2;
+    return argminSSE2; // SSE2 faz parte da base x86-64
+}
+
+const char* escolherNome() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? "AVX2" : "SSE2";
+}
+
+#else
+
+int argminEscalar(const double* v, int n) {
+    int melhor = -1;
+    double menor = INFINITO;
+    for (int i = 0; i < n; i++) {
+        if (v[i] < menor) {
+            menor = v[i];
+            melhor = i;
+        }
+    }
+    return melhor;
+}
+
+FuncaoArgmin escolherArgmin() {
+    return argminEscalar;
+}
+
+void relaxarSemSIMD(const double* pesos, double base, double* dist,
+                    double* chaves, int* pred, int predecessor, int n) {
+    relaxarEscalar(pesos, base, dist, chaves, pred, predecessor, 0, n);
+}
+
+FuncaoRelaxar escolherRelaxar() {
+    return relaxarSemSIMD;
+}
+
+void minPlusEscalar(float* C, const float* A, const float* B, int tamanho, int passo) {
+    for (int k = 0; k < tamanho; k++) {
+        const float* linhaB = B + static_cast<size_t>(k) * passo;
+        for (int i = 0; i < tamanho; i++) {
+            float a = A[static_cast<size_t>(i) * passo + k];
+            float* linhaC = C + static_cast<size_t>(i) * passo;
+            for (int j = 0; j < tamanho; j++) {
+                float nova = a + linhaB[j];
+                if (nova < linhaC[j]) linhaC[j] = nova;
+            }
+        }
+    }
+}
+
+FuncaoMinPlus escolherMinPlus() {
+    return minPlusEscalar;
+}
+
+void maximoBytesSemSIMD(uint8_t* destino, const uint8_t* origem, int n) {
+    maximoBytesEscalar(destino, origem, 0, n);
+}
+
+FuncaoMaximoBytes escolherMaximoBytes() {
+    return maximoBytesSemSIMD;
+}
+
+int intersecaoSemSIMD(const int* a, int na, const int* b, int nb, int* saida) {
+    return intersecaoEscalar(a, 0, na, b, 0, nb, saida, 0);
+}
+
+FuncaoIntersecao escolherIntersecao() {
+    return intersecaoSemSIMD;
+}
+
+const char* escolherNome() {
+    return "escalar";
+}
+
+#endif
+
+} // namespace
+
+int OperacoesSIMD::argmin(const double* v, int n) {
+    static const FuncaoArgmin funcao = escolherArgmin();
+    return funcao(v, n);
+}
+
+void OperacoesSIMD::relaxarLinha(const double* pesos, double base, double* dist,
+                                 double* chaves, int* pred, int predecessor, int n) {
+    static const FuncaoRelaxar funcao = escolherRelaxar();
+    funcao(pesos, base, dist, chaves, pred, predecessor, n);
+}
+
+void OperacoesSIMD::minPlusBloco(float* C, const float* A, const float* B, int tamanho, int passo) {
+    static const FuncaoMinPlus funcao = escolherMinPlus();
+    funcao(C, A, B, tamanho, passo);
+}
+
+void OperacoesSIMD::maximoBytes(uint8_t* destino, const uint8_t* origem, int n) {
+    static const FuncaoMaximoBytes funcao = escolherMaximoBytes();
+    funcao(destino, origem, n);
+}
+
+int OperacoesSIMD::intersecao(const int* a, int na, const int* b, int nb, int* saida) {
+    static const FuncaoIntersecao funcao = escolherIntersecao();
+    return funcao(a, na, b, nb, saida);
+}
+
+string OperacoesSIMD::conjuntoInstrucoes() {
+    return escolherNome();
+}
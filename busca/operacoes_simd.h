@@ -0,0 +1,43 @@
+#ifndef OPERACOES_SIMD_H
+#define OPERACOES_SIMD_H
+
+#include <string>
+#include <cstdint>
+using namespace std;
+
+// Operações vetoriais usadas pelas estratégias de Dijkstra, pelo
+// Floyd-Warshall blocado, pelos contadores do HyperANF e pela contagem de
+// triângulos. A implementação (AVX2, SSE2 ou escalar) é escolhida uma única vez
+// em tempo de execução, conforme o processador.
+class OperacoesSIMD {
+public:
+    // Índice do menor valor de v[0..n); em empate, o menor índice.
+    // Retorna -1 se n == 0 ou se todos os valores forem +infinito.
+    static int argmin(const double* v, int n);
+
+    // Para cada j com base + pesos[j] < dist[j]: dist[j] e chaves[j] recebem
+    // o novo valor e pred[j] recebe predecessor. Com pesos não negativos,
+    // vértices já fechados nunca melhoram, então não precisam de máscara.
+    static void relaxarLinha(const double* pesos, double base, double* dist,
+                             double* chaves, int* pred, int predecessor, int n);
+
+    // Produto min-plus de blocos tamanho x tamanho em matrizes float com
+    // passo "passo": C[i][j] = min(C[i][j], A[i][k] + B[k][j]), com k no laço
+    // externo. C pode coincidir com A ou com B (fases 1 e 2 do Floyd-Warshall).
+    static void minPlusBloco(float* C, const float* A, const float* B, int tamanho, int passo);
+
+    // destino[i] = max(destino[i], origem[i]) para i em [0, n): a união de
+    // dois contadores HyperLogLog registrador a registrador
+    static void maximoBytes(uint8_t* destino, const uint8_t* origem, int n);
+
+    // Elementos comuns de a[0..na) e b[0..nb), ambos estritamente crescentes,
+    // gravados em saida (espaço para min(na, nb)) em ordem crescente.
+    // Retorna quantos foram gravados. Compara blocos inteiros de a contra
+    // todas as rotações do bloco de b e avança o bloco de menor máximo.
+    static int intersecao(const int* a, int na, const int* b, int nb, int* saida);
+
+    // "AVX2", "SSE2" ou "escalar"
+    static string conjuntoInstrucoes();
+};
+
+#endif
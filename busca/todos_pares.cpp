@@ -0,0 +1,189 @@
+#include "todos_pares.h"
+#include "operacoes_simd.h"
+#include "dijkstra.h"
+#include "execucao_paralela.h"
+#include <iostream>
+#include <fstream>
+#include <limits>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include "../representacao_leitura/assinatura_grafo.h"
+
+namespace {
+const char MAGICO_TODOS_PARES[4] = {'A', 'P', 'S', '2'};
+const float INFINITO_FLOAT = numeric_limits<float>::infinity();
+} // namespace
+
+TodosPares::TodosPares(int numVertices) : n(numVertices) {
+    passo = ((n + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO) * TAMANHO_BLOCO;
+    assinaturaGrafo = 0;
+    tempoCalculoMs = 0.0;
+    threadsUsadas = 0;
+}
+
+float* TodosPares::bloco(int linhaBloco, int colunaBloco) {
+    return distancias.data() +
+           static_cast<size_t>(linhaBloco) * TAMANHO_BLOCO * passo +
+           static_cast<size_t>(colunaBloco) * TAMANHO_BLOCO;
+}
+
+void TodosPares::calcular(const IGrafoPeso& grafo, int numThreads) {
+    if (grafo.getNumVertices() != n) {
+        throw invalid_argument("Número de vértices do grafo não corresponde à tabela");
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+
+    threadsUsadas = ExecucaoParalela::resolverNumThreads(numThreads);
+
+    // Vértices de preenchimento (n..passo-1) ficam isolados: INF em tudo
+    distancias.assign(static_cast<size_t>(passo) * passo, INFINITO_FLOAT);
+    assinaturaGrafo = calcularAssinatura(grafo);
+    for (int u = 0; u < n; u++) {
+        float* linha = distancias.data() + static_cast<size_t>(u) * passo;
+        linha[u] = 0.0f;
+        for (const auto& [v, peso] : grafo.getVizinhosComPeso(u)) {
+            linha[v] = min(linha[v], static_cast<float>(peso));
+        }
+    }
+
+    int numBlocos = passo / TAMANHO_BLOCO;
+    for (int k = 0; k < numBlocos; k++) {
+        float* diagonal = bloco(k, k);
+
+        // Fase 1: bloco diagonal, Floyd-Warshall local
+        OperacoesSIMD::minPlusBloco(diagonal, diagonal, diagonal, TAMANHO_BLOCO, passo);
+
+        // Fase 2: blocos da linha k (índices 0..numBlocos-1) e da coluna k
+        ExecucaoParalela::paraCadaLote(2 * numBlocos, threadsUsadas, 1, [&](int ini, int fim, int) {
+            for (int t = ini; t < fim; t++) {
+                int outro = t % numBlocos;
+                if (outro == k) continue;
+                if (t < numBlocos) {
+                    float* linha = bloco(k, outro);
+                    OperacoesSIMD::minPlusBloco(linha, diagonal, linha, TAMANHO_BLOCO, passo);
+                } else {
+                    float* coluna = bloco(outro, k);
+                    OperacoesSIMD::minPlusBloco(coluna, coluna, diagonal, TAMANHO_BLOCO, passo);
+                }
+            }
+        });
+
+        // Fase 3: demais blocos; cada thread fica com linhas de blocos inteiras
+        ExecucaoParalela::paraCadaLote(numBlocos, threadsUsadas, 1, [&](int ini, int fim, int) {
+            for (int i = ini; i < fim; i++) {
+                if (i == k) continue;
+                const float* coluna = bloco(i, k);
+                for (int j = 0; j < numBlocos; j++) {
+                    if (j == k) continue;
+                    OperacoesSIMD::minPlusBloco(bloco(i, j), coluna, bloco(k, j), TAMANHO_BLOCO, passo);
+                }
+            }
+        });
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    tempoCalculoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+}
+
+double TodosPares::consultar(int origem, int destino) const {
+    if (origem < 1 || origem > n || destino < 1 || destino > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+    if (distancias.empty()) {
+        throw runtime_error("Tabela de distâncias não calculada");
+    }
+
+    float d = distancias[static_cast<size_t>(origem - 1) * passo + (destino - 1)];
+    return d == INFINITO_FLOAT ? INF : static_cast<double>(d);
+}
+
+void TodosPares::salvarEmArquivo(const string& nomeArquivo) const {
+    ofstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        throw runtime_error("Erro ao criar arquivo de distâncias");
+    }
+
+    int32_t numVertices = n;
+    arquivo.write(MAGICO_TODOS_PARES, sizeof(MAGICO_TODOS_PARES));
+    arquivo.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+    arquivo.write(reinterpret_cast<const char*>(&assinaturaGrafo), sizeof(assinaturaGrafo));
+
+    // Só as n primeiras colunas de cada linha; o preenchimento é refeito ao carregar
+    for (int u = 0; u < n; u++) {
+        arquivo.write(reinterpret_cast<const char*>(distancias.data() + static_cast<size_t>(u) * passo),
+                      n * sizeof(float));
+    }
+
+    if (!arquivo) {
+        throw runtime_error("Erro ao gravar arquivo de distâncias");
+    }
+}
+
+bool TodosPares::carregarDeArquivo(const string& nomeArquivo, const IGrafoPeso& grafo) {
+    ifstream arquivo(nomeArquivo, ios::binary);
+    if (!arquivo) {
+        return false;
+    }
+
+    char magico[4];
+    int32_t numVertices = 0;
+    uint64_t assinatura = 0;
+
+    arquivo.read(magico, sizeof(magico));
+    arquivo.read(reinterpret_cast<char*>(&numVertices), sizeof(numVertices));
+    arquivo.read(reinterpret_cast<char*>(&assinatura), sizeof(assinatura));
+
+    if (!arquivo || !equal(magico, magico + 4, MAGICO_TODOS_PARES) ||
+        numVertices != n || grafo.getNumVertices() != n ||
+        assinatura != calcularAssinatura(grafo)) {
+        return false;
+    }
+
+    vector<float> novas(static_cast<size_t>(passo) * passo, INFINITO_FLOAT);
+    for (int u = 0; u < n; u++) {
+        arquivo.read(reinterpret_cast<char*>(novas.data() + static_cast<size_t>(u) * passo),
+                     n * sizeof(float));
+    }
+
+    if (!arquivo) {
+        return false;
+    }
+
+    distancias = move(novas);
+    assinaturaGrafo = assinatura;
+    tempoCalculoMs = 0.0;
+    threadsUsadas = 0;
+    return true;
+}
+
+string TodosPares::caminhoArquivoDistancias(const string& caminhoGrafo) {
+    return caminhoGrafo + ".apsp";
+}
+
+size_t TodosPares::memoriaNecessaria(int numVertices) {
+    size_t passo = ((numVertices + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO) * TAMANHO_BLOCO;
+    return passo * passo * sizeof(float);
+}
+
+double TodosPares::getTempoCalculoMs() const {
+    return tempoCalculoMs;
+}
+
+size_t TodosPares::getMemoriaBytes() const {
+    return distancias.size() * sizeof(float);
+}
+
+void TodosPares::imprimirResumo() const {
+    cout << fixed << setprecision(3);
+    if (threadsUsadas > 0) {
+        cout << "• Tempo de cálculo: " << tempoCalculoMs << " ms (" << threadsUsadas << " threads, "
+             << OperacoesSIMD::conjuntoInstrucoes() << ")\n";
+    }
+    cout << setprecision(2);
+    cout << "• Tabela: " << n << " x " << n << " distâncias em float ("
+         << getMemoriaBytes() / (1024.0 * 1024.0) << " MB)\n";
+}
@@ -0,0 +1,55 @@
+#ifndef TODOS_PARES_H
+#define TODOS_PARES_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "../representacao_leitura/grafo_peso_interface.h"
+using namespace std;
+
+// Distâncias entre todos os pares por Floyd-Warshall blocado (min-plus com
+// SIMD sobre blocos de TAMANHO_BLOCO x TAMANHO_BLOCO). A cada rodada k o bloco
+// diagonal é fechado primeiro, depois os blocos da linha e da coluna k e por
+// fim os demais, que são independentes entre si e divididos entre threads.
+// As distâncias ficam em float, numa matriz com passo múltiplo do bloco.
+class TodosPares {
+private:
+    static constexpr int TAMANHO_BLOCO = 64;
+
+    int n;
+    int passo;                       // n arredondado para múltiplo de TAMANHO_BLOCO
+    vector<float> distancias;        // passo x passo, em ordem de linhas
+    uint64_t assinaturaGrafo; // vértices, vizinhos e pesos; valida o arquivo salvo
+    double tempoCalculoMs;
+    int threadsUsadas;
+
+    float* bloco(int linhaBloco, int colunaBloco);
+
+public:
+    TodosPares(int numVertices);
+
+    // numThreads <= 0 usa todas as threads de hardware
+    void calcular(const IGrafoPeso& grafo, int numThreads = 0);
+
+    // origem e destino em base 1; INF se não houver caminho
+    double consultar(int origem, int destino) const;
+
+    void salvarEmArquivo(const string& nomeArquivo) const;
+
+    // Retorna false se o arquivo não existir ou não corresponder ao grafo
+    bool carregarDeArquivo(const string& nomeArquivo, const IGrafoPeso& grafo);
+
+    // Arquivo da tabela gravado ao lado do arquivo do grafo
+    static string caminhoArquivoDistancias(const string& caminhoGrafo);
+
+    static size_t memoriaNecessaria(int numVertices);
+
+    double getTempoCalculoMs() const;
+
+    size_t getMemoriaBytes() const;
+
+    void imprimirResumo() const;
+};
+
+#endif
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <random>
 #include <stdexcept>
+#include <functional>
 
 // Includes para as funcionalidades do projeto
 #include "mapping.h"
@@ -18,32 +19,75 @@
 #include "representacao_leitura/matriz_adjacencia.h"
 #include "representacao_leitura/lista_adjacencia.h"
 #include "representacao_leitura/lista_adjacencia_peso.h"
+#include "representacao_leitura/matriz_adjacencia_peso.h"
+#include "representacao_leitura/grafo_csr.h"
 #include "representacao_leitura/matriz_adjacencia_adapter.h"
 #include "representacao_leitura/lista_adjacencia_adapter.h"
 #include "representacao_leitura/lista_adjacencia_peso_adapter.h"
+#include "representacao_leitura/assinatura_grafo.h"
 #include "busca/bfs.h"
 #include "busca/dfs.h"
 #include "busca/dijkstra.h"
 #include "busca/dijkstra_vetor_strategy.h"
 #include "busca/dijkstra_heap_strategy.h"
+#include "busca/dijkstra_torneio_strategy.h"
+#include "busca/dijkstra_paralelo.h"
+#include "busca/alt.h"
+#include "busca/hierarquia_contracao.h"
+#include "busca/todos_pares.h"
+#include "busca/dijkstra_dinamico.h"
+#include "busca/cache_dijkstra.h"
+#include "busca/multiplas_origens.h"
 #include "analise/estatisticas.h"
 #include "analise/componentes.h"
+#include "analise/componentes_paralelo.h"
+#include "analise/conectividade_incremental.h"
 #include "analise/distancias.h"
+#include "analise/centralidade.h"
+#include "analise/hyperanf.h"
+#include "analise/triangulos.h"
+#include "analise/decomposicao_nucleos.h"
+#include "analise/pagerank.h"
+#include "analise/rotulacao_podada.h"
 
 using namespace std;
 
+// Acima disso as tabelas densas n x n (matriz com peso, distâncias entre
+// todos os pares) não são montadas
+const size_t LIMITE_MATRIZ_PESO_BYTES = 2ULL * 1024 * 1024 * 1024;
+
+// Acima disso os contadores do HyperANF não são alocados
+const size_t LIMITE_CONTADORES_HYPERANF_BYTES = 1ULL * 1024 * 1024 * 1024;
+
+// Memória reservada às árvores de caminhos mínimos já calculadas na sessão
+const size_t ORCAMENTO_CACHE_DIJKSTRA_BYTES = 256ULL * 1024 * 1024;
+
 class MenuInterativo {
 private:
     string grafoSelecionado;
     string tipoEstrutura; // "matriz" ou "lista"
     bool grafoPeso;
-    string tipoDijkstra; // "vetor" ou "heap"
+    string tipoDijkstra; // "vetor", "heap" ou "torneio"
+    string motorComponentes = "uniao-busca"; // ou "afforest"
+    int precisaoHyperANF = 7; // log2 dos registradores por contador
     
     // Dados carregados
     unique_ptr<MatrizAdjacencia> matriz;
     unique_ptr<ListaAdjacencia> lista;
     unique_ptr<ListaAdjacenciaPeso> listaPeso;
+    unique_ptr<ComponentesConexas> componentes; // calculadas na carga de grafos sem peso
+    unique_ptr<MatrizAdjacenciaPeso> matrizPeso; // carregada junto com listaPeso se a estrutura for "matriz"
     unique_ptr<Mapping> mappingPesquisadores;
+    unique_ptr<ALT> alt;
+    string grafoALT; // grafo para o qual os marcos ALT foram preparados
+    unique_ptr<HierarquiaContracao> hierarquia;
+    string grafoHierarquia;
+    unique_ptr<TodosPares> todosPares;
+    string grafoTodosPares;
+    unique_ptr<RotulacaoPodada> rotulos;
+    string grafoRotulos;
+    CacheDijkstra cacheDijkstra{ORCAMENTO_CACHE_DIJKSTRA_BYTES};
+    uint64_t assinaturaCacheDijkstra = 0; // grafo com peso cujas árvores estão no cache
     int numVertices;
     
     void limparTela() {
@@ -152,6 +196,10 @@ private:
         grafoSelecionado = grafos[escolha - 1];
         grafoPeso = verificarSeGrafoPeso(grafoSelecionado);
         mappingPesquisadores.reset();
+        alt.reset();
+        hierarquia.reset();
+        todosPares.reset();
+        rotulos.reset();
         
         cout << "\n✅ Grafo selecionado: " << grafoSelecionado;
         if (grafoPeso) {
@@ -206,6 +254,227 @@ private:
         pausar();
     }
     
+    void configurarComponentes() {
+        limparTela();
+        mostrarCabecalho();
+
+        cout << "┌─────────────────────────────────────────────────────────────┐\n";
+        cout << "│             CONFIGURAÇÃO DAS COMPONENTES CONEXAS           │\n";
+        cout << "└─────────────────────────────────────────────────────────────┘\n\n";
+
+        cout << "Escolha o motor de componentes conexas (grafos sem peso):\n\n";
+        cout << "1. União-busca sequencial sobre a lista de arestas\n";
+        cout << "2. Afforest paralelo (amostragem de vizinhos, grafos grandes)\n";
+        cout << "3. Medir escalabilidade do Afforest com o grafo selecionado\n";
+        cout << "4. Inserir as arestas em lotes: conectividade incremental x recálculo\n";
+        cout << "5. Comparar k-núcleos: Batagelj-Zaversnik x remoção paralela em camadas\n";
+        cout << "0. Voltar ao menu principal\n\n";
+        cout << "👉 Digite sua escolha: ";
+
+        int escolha;
+        cin >> escolha;
+
+        switch (escolha) {
+            case 1:
+                motorComponentes = "uniao-busca";
+                cout << "\n✅ Componentes conexas: união-busca sequencial\n";
+                break;
+            case 2:
+                motorComponentes = "afforest";
+                cout << "\n✅ Componentes conexas: Afforest com "
+                     << ComponentesParalelo().getNumThreads() << " threads\n";
+                break;
+            case 3:
+                medirEscalabilidadeComponentes();
+                break;
+            case 4:
+                simularInsercoesEmLotes();
+                break;
+            case 5:
+                compararDecomposicaoNucleos();
+                break;
+            case 0:
+                return;
+            default:
+                cout << "❌ Opção inválida!\n";
+                break;
+        }
+        pausar();
+    }
+
+    void medirEscalabilidadeComponentes() {
+        if (grafoSelecionado.empty() || grafoPeso) {
+            cout << "\n❌ Selecione primeiro um grafo sem peso!\n";
+            return;
+        }
+
+        try {
+            cout << "\n📂 Lendo " << grafoSelecionado << "...\n";
+            DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+            int n = dados.numVertices;
+
+            auto inicio = chrono::high_resolution_clock::now();
+            ComponentesConexas referencia(n);
+            referencia.encontrarComponentes(dados);
+            auto fim = chrono::high_resolution_clock::now();
+            double tempoUniao = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+
+            inicio = chrono::high_resolution_clock::now();
+            GrafoCSR csr(dados);
+            fim = chrono::high_resolution_clock::now();
+            double tempoCSR = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+
+            cout << "\n📊 ESCALABILIDADE DAS COMPONENTES CONEXAS:\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            cout << fixed << setprecision(3);
+            cout << "🔸 Componentes: " << referencia.getNumComponentes() << "\n";
+            cout << "🔸 União-busca sequencial: " << tempoUniao << " ms\n";
+            cout << "🔸 Montagem da adjacência CSR: " << tempoCSR << " ms ("
+                 << setprecision(1) << csr.getMemoriaBytes() / (1024.0 * 1024.0) << " MB)\n\n";
+
+            int maxThreads = ComponentesParalelo().getNumThreads();
+            double tempoUmaThread = 0.0;
+            for (int threads = 1; ; threads = min(threads * 2, maxThreads)) {
+                ComponentesParalelo afforest(threads);
+                ComponentesConexas resultado(n);
+                afforest.encontrarComponentes(csr, resultado);
+
+                bool iguais = resultado.getNumComponentes() == referencia.getNumComponentes() &&
+                              resultado.getVerticesAgrupados() == referencia.getVerticesAgrupados();
+                for (int i = 0; iguais && i < resultado.getNumComponentes(); i++) {
+                    iguais = resultado.getComponentes()[i].tamanho == referencia.getComponentes()[i].tamanho;
+                }
+                if (threads == 1) {
+                    tempoUmaThread = afforest.getTempoMs();
+                }
+
+                cout << "   Afforest " << setw(3) << threads << " threads: " << setprecision(3)
+                     << setw(10) << afforest.getTempoMs() << " ms  (aceleração "
+                     << setprecision(2) << tempoUmaThread / max(afforest.getTempoMs(), 0.001) << "x, "
+                     << setprecision(1) << 100.0 * afforest.getFracaoIgnorada() << "% ignorados na fase final) "
+                     << (iguais ? "✅" : "❌ diverge") << "\n";
+
+                if (threads == maxThreads) break;
+            }
+        } catch (const exception& e) {
+            cout << "❌ Erro durante a medição: " << e.what() << "\n";
+        }
+    }
+
+    void compararDecomposicaoNucleos() {
+        if (grafoSelecionado.empty() || grafoPeso) {
+            cout << "\n❌ Selecione primeiro um grafo sem peso!\n";
+            return;
+        }
+
+        try {
+            cout << "\n📂 Lendo " << grafoSelecionado << "...\n";
+            DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+            GrafoCSR csr(dados);
+
+            DecomposicaoNucleos referencia;
+            referencia.calcular(csr);
+
+            cout << "\n📊 DECOMPOSIÇÃO EM K-NÚCLEOS:\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            cout << fixed << setprecision(3);
+            cout << "🔸 Degeneração: " << referencia.getDegeneracao() << " (k-núcleo máximo com "
+                 << referencia.getTamanhosKNucleos()[referencia.getDegeneracao()] << " vértices)\n";
+            cout << "🔸 Batagelj-Zaversnik sequencial: " << referencia.getTempoMs() << " ms\n\n";
+
+            int maxThreads = DecomposicaoNucleos().getNumThreads();
+            double tempoUmaThread = 0.0;
+            for (int threads = 1; ; threads = min(threads * 2, maxThreads)) {
+                DecomposicaoNucleos paralela(threads);
+                paralela.calcularParalelo(csr);
+                if (threads == 1) {
+                    tempoUmaThread = paralela.getTempoMs();
+                }
+
+                cout << "   Remoção em camadas " << setw(3) << threads << " threads: " << setprecision(3)
+                     << setw(10) << paralela.getTempoMs() << " ms  (aceleração "
+                     << setprecision(2) << tempoUmaThread / max(paralela.getTempoMs(), 0.001) << "x, "
+                     << paralela.getNumRodadas() << " rodadas) "
+                     << (paralela.getNucleos() == referencia.getNucleos() ? "✅" : "❌ diverge") << "\n";
+
+                if (threads == maxThreads) break;
+            }
+        } catch (const exception& e) {
+            cout << "❌ Erro durante a decomposição: " << e.what() << "\n";
+        }
+    }
+
+    // Reproduz o grafo selecionado como um fluxo de arestas em ordem aleatória,
+    // comparando a atualização incremental com recalcular tudo a cada lote
+    void simularInsercoesEmLotes() {
+        if (grafoSelecionado.empty() || grafoPeso) {
+            cout << "\n❌ Selecione primeiro um grafo sem peso!\n";
+            return;
+        }
+
+        cout << "\n👉 Número de lotes: ";
+        int numLotes;
+        cin >> numLotes;
+        if (numLotes < 1) {
+            cout << "❌ Número de lotes inválido!\n";
+            return;
+        }
+
+        try {
+            DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+            mt19937 gerador(42);
+            shuffle(dados.arestas.begin(), dados.arestas.end(), gerador);
+
+            int n = dados.numVertices;
+            size_t m = dados.arestas.size();
+            ConectividadeIncremental conectividade(n);
+            DadosGrafo parcial{n, {}};
+            double tempoRecalculo = 0.0;
+            bool iguais = true;
+
+            cout << "\n📊 INSERÇÃO EM " << numLotes << " LOTES (" << m << " arestas):\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            cout << "  Lote   Componentes   Maior   Incremental (ms)   Recálculo (ms)\n";
+
+            for (int lote = 0; lote < numLotes; lote++) {
+                size_t inicio = m * lote / numLotes;
+                size_t fim = m * (lote + 1) / numLotes;
+                vector<pair<int, int>> arestas(dados.arestas.begin() + inicio, dados.arestas.begin() + fim);
+
+                EstatisticasLote estatisticas = conectividade.inserirArestas(arestas);
+
+                // Alternativa sem estado: union-find do zero sobre tudo o que já chegou
+                parcial.arestas.insert(parcial.arestas.end(), arestas.begin(), arestas.end());
+                auto t0 = chrono::high_resolution_clock::now();
+                ComponentesConexas recalculadas(n);
+                recalculadas.encontrarComponentes(parcial);
+                auto t1 = chrono::high_resolution_clock::now();
+                double tempoLote = chrono::duration_cast<chrono::microseconds>(t1 - t0).count() / 1000.0;
+                tempoRecalculo += tempoLote;
+
+                iguais = iguais && recalculadas.getNumComponentes() == conectividade.getNumComponentes() &&
+                         recalculadas.getComponentes()[0].tamanho == conectividade.getMaiorComponente();
+
+                cout << "  " << setw(4) << lote + 1 << "   " << setw(11) << conectividade.getNumComponentes()
+                     << "   " << setw(5) << conectividade.getMaiorComponente() << "   " << fixed << setprecision(3)
+                     << setw(16) << estatisticas.tempoMs << "   " << setw(14) << tempoLote << "\n";
+            }
+
+            ComponentesConexas finais(n);
+            conectividade.exportar(finais);
+            ComponentesConexas referencia(n);
+            referencia.encontrarComponentes(dados);
+            iguais = iguais && finais.getVerticesAgrupados() == referencia.getVerticesAgrupados();
+
+            cout << "\n🔸 Vazão incremental: " << setprecision(0) << conectividade.getArestasPorSegundo()
+                 << " arestas/s\n";
+            cout << "🔸 Recálculo acumulado: " << setprecision(3) << tempoRecalculo << " ms\n";
+            cout << "🔸 Resultado igual ao recálculo: " << (iguais ? "✅ Sim" : "❌ Não") << "\n";
+        } catch (const exception& e) {
+            cout << "❌ Erro durante a simulação: " << e.what() << "\n";
+        }
+    }
+
     void configurarDijkstra() {
         limparTela();
         mostrarCabecalho();
@@ -223,6 +492,9 @@ private:
         cout << "Escolha a implementação do algoritmo de Dijkstra:\n\n";
         cout << "1. Implementação com Vetor (mais simples)\n";
         cout << "2. Implementação com Heap (mais eficiente)\n";
+        cout << "3. Implementação com Vetor + árvore de torneio (grafos densos)\n";
+        cout << "4. " << (cacheDijkstra.getDistanciasFloat() ? "Desativar" : "Ativar")
+             << " distâncias em float no cache (menos memória, valores arredondados)\n";
         cout << "0. Voltar ao menu principal\n\n";
         cout << "👉 Digite sua escolha: ";
         
@@ -238,6 +510,16 @@ private:
                 tipoDijkstra = "heap";
                 cout << "\n✅ Dijkstra configurado: Implementação com Heap\n";
                 break;
+            case 3:
+                tipoDijkstra = "torneio";
+                cout << "\n✅ Dijkstra configurado: Vetor com árvore de torneio\n";
+                cout << "🔸 Busca do mínimo vetorizada: " << OperacoesSIMD::conjuntoInstrucoes() << "\n";
+                break;
+            case 4:
+                cacheDijkstra.setDistanciasFloat(!cacheDijkstra.getDistanciasFloat());
+                cout << "\n✅ Cache de Dijkstra: distâncias em "
+                     << (cacheDijkstra.getDistanciasFloat() ? "float" : "double") << " (cache esvaziado)\n";
+                break;
             case 0:
                 return;
             default:
@@ -264,7 +546,29 @@ private:
                 DadosGrafoPeso dados = LeitorGrafo::lerArquivoComPeso(caminhoArquivo);
                 listaPeso = make_unique<ListaAdjacenciaPeso>(dados);
                 numVertices = listaPeso->getNumVertices();
+                matrizPeso.reset();
+
+                // Árvores calculadas com outros pesos não podem ser reaproveitadas
+                uint64_t assinatura = calcularAssinatura(ListaAdjacenciaPesoAdapter(*listaPeso));
+                if (assinatura != assinaturaCacheDijkstra) {
+                    cacheDijkstra.limpar();
+                    assinaturaCacheDijkstra = assinatura;
+                }
                 cout << "✅ Grafo com peso carregado com sucesso!\n";
+                cout << "🔸 Caminhos mínimos: "
+                     << Dijkstra::descreverMotor(Dijkstra::escolherMotor(*listaPeso), *listaPeso) << "\n";
+                
+                if (tipoEstrutura == "matriz") {
+                    size_t memoria = MatrizAdjacenciaPeso::memoriaNecessaria(numVertices);
+                    if (memoria > LIMITE_MATRIZ_PESO_BYTES) {
+                        cout << "⚠️  Matriz com peso ocuparia " << memoria / (1024 * 1024)
+                             << " MB; usando apenas a lista de adjacência\n";
+                    } else {
+                        matrizPeso = make_unique<MatrizAdjacenciaPeso>(dados);
+                        cout << "✅ Matriz de adjacência com peso carregada ("
+                             << memoria / (1024 * 1024) << " MB)\n";
+                    }
+                }
             } else {
                 DadosGrafo dados = LeitorGrafo::lerArquivo(caminhoArquivo);
                 if (tipoEstrutura == "matriz") {
@@ -274,6 +578,19 @@ private:
                     lista = make_unique<ListaAdjacencia>(dados);
                     numVertices = dados.numVertices;
                 }
+
+                // Componentes saem da própria lista de arestas (union-find) ou
+                // do Afforest paralelo sobre a adjacência compacta
+                componentes = make_unique<ComponentesConexas>(numVertices);
+                if (motorComponentes == "afforest") {
+                    GrafoCSR csr(dados);
+                    ComponentesParalelo afforest;
+                    afforest.encontrarComponentes(csr, *componentes);
+                    cout << "🔸 Componentes por Afforest: " << fixed << setprecision(3) << afforest.getTempoMs()
+                         << " ms com " << afforest.getNumThreads() << " threads\n";
+                } else {
+                    componentes->encontrarComponentes(dados);
+                }
                 cout << "✅ Grafo carregado com sucesso!\n";
             }
             
@@ -334,6 +651,10 @@ private:
         cout << "1. Buscar ID pelo nome\n";
         cout << "2. Buscar nome pelo ID\n";
         cout << "3. Calcular distância entre pesquisadores (Dijkstra)\n";
+        cout << "4. Calcular distância entre grupos de pesquisadores (Dijkstra multi-origem)\n";
+        cout << "5. Ranking de pesquisadores por centralidade (Brandes, proximidade, harmônica)\n";
+        cout << "6. Ranking de pesquisadores por PageRank\n";
+        cout << "7. PageRank personalizado a partir de um pesquisador\n";
         cout << "0. Voltar\n\n";
         cout << "👉 Digite sua escolha: ";
 
@@ -399,6 +720,24 @@ private:
             case 3:
                 calcularDistanciaEntrePesquisadores();
                 break;
+            case 4:
+                calcularDistanciaEntreGrupos();
+                break;
+            case 5:
+                if (carregarGrafo()) {
+                    rankingCentralidade();
+                }
+                break;
+            case 6:
+                if (carregarGrafo()) {
+                    rankingPageRank();
+                }
+                break;
+            case 7:
+                if (carregarGrafo()) {
+                    pageRankPersonalizado();
+                }
+                break;
             case 0:
                 return;
             default:
@@ -500,19 +839,40 @@ private:
             cout << "   🔹 Destino: " << mappingPesquisadores->obterNomePorId(idDestino)
                  << " (ID: " << idDestino << ")\n\n";
 
-            // Executar Dijkstra
-            cout << "🔍 Executando algoritmo de Dijkstra (" << tipoDijkstra << ")...\n";
+            double distanciaTotal;
+            vector<int> caminho;
 
-            ResultadoDijkstra resultado;
-            if (tipoDijkstra == "vetor") {
-                resultado = Dijkstra::dijkstraVetor(*listaPeso, idOrigem);
+            if (hierarquiaDisponivel()) {
+                // Hierarquia pré-processada em disco: evita um Dijkstra completo por consulta
+                cout << "⚡ Usando hierarquia de contração salva...\n";
+                ResultadoConsultaCH consulta = hierarquia->consultar(idOrigem, idDestino);
+                distanciaTotal = consulta.distancia;
+                caminho = consulta.caminho;
             } else {
-                resultado = Dijkstra::dijkstraHeap(*listaPeso, idOrigem);
+                // Executar Dijkstra
+                cout << "🔍 Executando algoritmo de Dijkstra (" << tipoDijkstra << ")...\n";
+
+                ResultadoDijkstra resultado = executarCaminhosMinimos(idOrigem);
+
+                distanciaTotal = resultado.distancias[idDestino - 1];
+
+                // Reconstruir caminho
+                int atual = idDestino;
+                while (atual != idOrigem && atual != -1) {
+                    caminho.push_back(atual);
+                    atual = resultado.predecessores[atual-1];
+                }
+
+                if (atual == idOrigem) {
+                    caminho.push_back(idOrigem);
+                    reverse(caminho.begin(), caminho.end());
+                } else {
+                    caminho.clear();
+                }
             }
 
             // Verificar se há caminho
-            int destinoIdx = idDestino - 1;
-            if (resultado.distancias[destinoIdx] == numeric_limits<double>::infinity()) {
+            if (distanciaTotal == numeric_limits<double>::infinity()) {
                 cout << "\n❌ Não há caminho entre os pesquisadores selecionados!\n";
                 cout << "   Os pesquisadores estão em componentes desconexas do grafo.\n";
                 return;
@@ -522,19 +882,10 @@ private:
             cout << "\n✅ RESULTADO:\n";
             cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
             cout << "📏 Distância total: " << fixed << setprecision(2)
-                 << resultado.distancias[destinoIdx] << "\n\n";
-
-            // Reconstruir caminho
-            vector<int> caminho;
-            int atual = idDestino;
-            while (atual != idOrigem && atual != -1) {
-                caminho.push_back(atual);
-                atual = resultado.predecessores[atual-1];
-            }
+                 << distanciaTotal << "\n\n";
 
-            if (atual == idOrigem) {
-                caminho.push_back(idOrigem);
-                reverse(caminho.begin(), caminho.end());
+            if (!caminho.empty()) {
+                const auto& adjacencia = listaPeso->getLista();
 
                 cout << "🛤️  Caminho (total de " << caminho.size() << " pesquisadores):\n\n";
                 for (size_t i = 0; i < caminho.size(); i++) {
@@ -543,9 +894,14 @@ private:
                     cout << "   " << setw(2) << (i+1) << ". " << nome << " (ID: " << id << ")";
 
                     if (i < caminho.size() - 1) {
-                        // Calcular peso da aresta
+                        // Com arestas paralelas o caminho mínimo usa a de menor peso
                         int proximoId = caminho[i+1];
-                        double pesoAresta = resultado.distancias[proximoId-1] - resultado.distancias[id-1];
+                        double pesoAresta = numeric_limits<double>::infinity();
+                        for (const auto& [vizinho, peso] : adjacencia[id - 1]) {
+                            if (vizinho == proximoId) {
+                                pesoAresta = min(pesoAresta, peso);
+                            }
+                        }
                         cout << "\n       ↓ (peso: " << fixed << setprecision(2) << pesoAresta << ")\n";
                     }
                     cout << "\n";
@@ -563,6 +919,287 @@ private:
         }
     }
     
+    // Lê nomes separados por ';' e devolve todos os IDs correspondentes
+    vector<int> lerGrupoPesquisadores(const string& descricao) {
+        cout << "👥 " << descricao << " (nomes separados por ';'): ";
+        string linha;
+        getline(cin, linha);
+
+        vector<int> ids;
+        stringstream ss(linha);
+        string nome;
+        while (getline(ss, nome, ';')) {
+            size_t inicio = nome.find_first_not_of(" \t");
+            size_t fim = nome.find_last_not_of(" \t");
+            if (inicio == string::npos) continue;
+            nome = nome.substr(inicio, fim - inicio + 1);
+
+            try {
+                vector<int> encontrados = mappingPesquisadores->obterIdsPorNome(nome);
+                ids.insert(ids.end(), encontrados.begin(), encontrados.end());
+            } catch (const out_of_range&) {
+                cout << "   ⚠️  Nome não encontrado, ignorado: " << nome << "\n";
+            }
+        }
+        return ids;
+    }
+
+    // Usa o grafo carregado (BFS sem peso, Dijkstra com peso); mostra nomes se houver mapeamento
+    void rankingCentralidade() {
+        cout << "\n1. Exato (uma busca por vértice)\n";
+        cout << "2. Amostrado com garantia de erro (epsilon, delta)\n";
+        cout << "👉 Digite sua escolha: ";
+        int modo;
+        cin >> modo;
+
+        double epsilon = 0.0, delta = 0.0;
+        if (modo == 2) {
+            cout << "👉 Erro absoluto máximo epsilon (ex.: 0.01): ";
+            cin >> epsilon;
+            cout << "👉 Probabilidade de falha delta (ex.: 0.1): ";
+            cin >> delta;
+        } else if (modo != 1) {
+            cout << "❌ Opção inválida!\n";
+            return;
+        }
+
+        cout << "👉 Quantos vértices no ranking? ";
+        int k;
+        cin >> k;
+        if (!cin || k <= 0) {
+            cin.clear();
+            cout << "❌ Valor inválido!\n";
+            return;
+        }
+
+        try {
+            unique_ptr<Centralidade> centralidade;
+            if (grafoPeso) {
+                ListaAdjacenciaPesoAdapter adapter(*listaPeso);
+                centralidade = make_unique<Centralidade>(adapter);
+            } else {
+                centralidade = make_unique<Centralidade>(*criarAdapterSemPeso());
+            }
+
+            cout << "\n🔄 Calculando centralidades (" << (grafoPeso ? "Dijkstra" : "BFS") << ", "
+                 << centralidade->getNumThreads() << " threads)...\n";
+            if (modo == 1) {
+                centralidade->calcularExato();
+            } else {
+                centralidade->calcularAmostrado(epsilon, delta);
+            }
+
+            cout << "✅ " << centralidade->getNumOrigens() << " origens em " << fixed << setprecision(3)
+                 << centralidade->getTempoMs() << " ms";
+            if (centralidade->isAmostrado()) {
+                cout << " (erro <= " << setprecision(4) << epsilon * numVertices / max(numVertices - 1, 1)
+                     << " com probabilidade >= " << setprecision(2) << 1.0 - delta << ")";
+            } else if (modo == 2) {
+                cout << " (a amostra exigida passava de n: cálculo exato)";
+            }
+            cout << "\n";
+
+            auto imprimirRanking = [&](const string& titulo, const vector<double>& valores) {
+                cout << "\n🏆 " << titulo << ":\n";
+                cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+                int posicao = 1;
+                for (const auto& [vertice, valor] : Centralidade::maiores(valores, k)) {
+                    cout << "  " << setw(3) << posicao++ << ". " << fixed << setprecision(6) << valor << "  ";
+                    imprimirPesquisador(vertice);
+                }
+            };
+
+            imprimirRanking("Intermediação (betweenness normalizada)", centralidade->getIntermediacao());
+            imprimirRanking("Proximidade (closeness)", centralidade->getProximidade());
+            imprimirRanking("Centralidade harmônica", centralidade->getHarmonica());
+        } catch (const exception& e) {
+            cout << "❌ Erro ao calcular centralidades: " << e.what() << "\n";
+        }
+    }
+
+    unique_ptr<PageRank> criarPageRank() {
+        if (grafoPeso) {
+            ListaAdjacenciaPesoAdapter adapter(*listaPeso);
+            return make_unique<PageRank>(adapter);
+        }
+        return make_unique<PageRank>(*criarAdapterSemPeso());
+    }
+
+    void imprimirPesquisador(int vertice) {
+        if (mappingPesquisadores && mappingPesquisadores->contemId(vertice)) {
+            cout << mappingPesquisadores->obterNomePorId(vertice) << " (ID: " << vertice << ")\n";
+        } else {
+            cout << "vértice " << vertice << "\n";
+        }
+    }
+
+    // Pesos do grafo carregado (quando houver) definem as probabilidades de transição
+    void rankingPageRank() {
+        cout << "\n👉 Tolerância da variação L1 (ex.: 1e-10): ";
+        double tolerancia;
+        cin >> tolerancia;
+        cout << "👉 Quantos pesquisadores no ranking? ";
+        int k;
+        cin >> k;
+        if (!cin || k <= 0 || tolerancia <= 0) {
+            cin.clear();
+            cout << "❌ Valor inválido!\n";
+            return;
+        }
+
+        try {
+            unique_ptr<PageRank> pageRank = criarPageRank();
+            cout << "\n🔄 Calculando PageRank (" << (grafoPeso ? "com peso" : "sem peso") << ", "
+                 << pageRank->getNumThreads() << " threads)...\n";
+            pageRank->calcular(0.85, tolerancia);
+
+            cout << (pageRank->getConvergiu() ? "✅ Convergiu" : "⚠️  Limite de iterações atingido")
+                 << " em " << pageRank->getNumIteracoes() << " iterações: " << fixed << setprecision(3)
+                 << pageRank->getTempoMs() << " ms (" << pageRank->getTempoPorIteracaoMs()
+                 << " ms por iteração, variação final " << scientific << setprecision(2)
+                 << pageRank->getVariacaoFinal() << ")\n";
+
+            cout << "\n🏆 PageRank (amortecimento 0.85):\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            int posicao = 1;
+            for (const auto& [vertice, valor] : Centralidade::maiores(pageRank->getValores(), k)) {
+                cout << "  " << setw(3) << posicao++ << ". " << fixed << setprecision(6) << valor << "  ";
+                imprimirPesquisador(vertice);
+            }
+        } catch (const exception& e) {
+            cout << "❌ Erro ao calcular PageRank: " << e.what() << "\n";
+        }
+    }
+
+    void pageRankPersonalizado() {
+        cout << "👤 Nome do pesquisador de origem: ";
+        string nome;
+        getline(cin, nome);
+        if (nome.empty()) {
+            cout << "\n❌ Nome vazio. Operação cancelada.\n";
+            return;
+        }
+
+        try {
+            vector<int> ids = mappingPesquisadores->obterIdsPorNome(nome);
+            int origem = ids.front();
+            if (ids.size() > 1) {
+                cout << "\n⚠️  Múltiplos pesquisadores encontrados com o nome '" << nome << "':\n";
+                for (size_t i = 0; i < ids.size(); i++) {
+                    cout << "   " << (i+1) << ". ID " << ids[i] << ": "
+                         << mappingPesquisadores->obterNomePorId(ids[i]) << "\n";
+                }
+                cout << "\n👉 Selecione o número correspondente: ";
+                int selecao;
+                cin >> selecao;
+                if (selecao < 1 || selecao > static_cast<int>(ids.size())) {
+                    cout << "\n❌ Seleção inválida.\n";
+                    return;
+                }
+                origem = ids[selecao - 1];
+            }
+
+            cout << "👉 Quantos pesquisadores no ranking? ";
+            int k;
+            cin >> k;
+            if (!cin || k <= 0) {
+                cin.clear();
+                cout << "❌ Valor inválido!\n";
+                return;
+            }
+
+            unique_ptr<PageRank> pageRank = criarPageRank();
+            const double epsilon = 1e-7;
+            pageRank->calcularPersonalizado(origem, 0.85, epsilon);
+            const auto& resultado = pageRank->getPersonalizado();
+
+            cout << "\n✅ " << resultado.size() << " pesquisadores tocados, " << pageRank->getNumEmpurroes()
+                 << " empurrões em " << fixed << setprecision(3) << pageRank->getTempoPersonalizadoMs()
+                 << " ms (resíduo " << scientific << setprecision(2) << pageRank->getResiduoPersonalizado()
+                 << ", erro por vértice <= " << epsilon << " x peso total)\n";
+
+            cout << "\n🏆 PageRank personalizado a partir de " << mappingPesquisadores->obterNomePorId(origem) << ":\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            int limite = min(k, static_cast<int>(resultado.size()));
+            for (int i = 0; i < limite; i++) {
+                cout << "  " << setw(3) << (i + 1) << ". " << fixed << setprecision(6) << resultado[i].second << "  ";
+                imprimirPesquisador(resultado[i].first);
+            }
+        } catch (const out_of_range&) {
+            cout << "\n❌ Nome não encontrado. Verifique a grafia exata.\n";
+        } catch (const exception& e) {
+            cout << "❌ Erro ao calcular PageRank personalizado: " << e.what() << "\n";
+        }
+    }
+
+    void calcularDistanciaEntreGrupos() {
+        limparTela();
+        mostrarCabecalho();
+
+        cout << "┌─────────────────────────────────────────────────────────────┐\n";
+        cout << "│         DISTÂNCIA ENTRE GRUPOS DE PESQUISADORES            │\n";
+        cout << "└─────────────────────────────────────────────────────────────┘\n\n";
+
+        if (!carregarGrafo()) {
+            return;
+        }
+
+        vector<int> grupoA = lerGrupoPesquisadores("Grupo de origem");
+        vector<int> grupoB = lerGrupoPesquisadores("Grupo de destino");
+        if (grupoA.empty() || grupoB.empty()) {
+            cout << "\n❌ Os dois grupos precisam de ao menos um pesquisador.\n";
+            return;
+        }
+
+        try {
+            ListaAdjacenciaPesoAdapter adapter(*listaPeso);
+
+            // Par mais próximo: uma só busca, interrompida no primeiro destino fechado
+            auto inicio = chrono::high_resolution_clock::now();
+            ResultadoEntreConjuntos par = MultiplasOrigens::dijkstraEntreConjuntos(adapter, grupoA, grupoB);
+            auto fim = chrono::high_resolution_clock::now();
+            double tempoPar = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+
+            if (par.destino == -1) {
+                cout << "\n❌ Nenhum pesquisador do grupo de destino é alcançável a partir do grupo de origem.\n";
+                return;
+            }
+
+            cout << "\n✅ PAR MAIS PRÓXIMO:\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            cout << "🔸 " << mappingPesquisadores->obterNomePorId(par.origem) << " (ID: " << par.origem << ") → "
+                 << mappingPesquisadores->obterNomePorId(par.destino) << " (ID: " << par.destino << ")\n";
+            cout << "📏 Distância: " << fixed << setprecision(2) << par.distancia << "\n";
+            cout << "🛤️  Caminho: ";
+            for (size_t i = 0; i < par.caminho.size(); i++) {
+                cout << par.caminho[i] << (i + 1 < par.caminho.size() ? " → " : "\n");
+            }
+            cout << "⏱️  " << setprecision(3) << tempoPar << " ms, " << par.verticesFechados << " de "
+                 << numVertices << " vértices fechados antes da parada\n";
+
+            // Membro de origem mais próximo de cada pesquisador do grupo de destino
+            ResultadoMultiplasOrigens todos = MultiplasOrigens::dijkstra(adapter, grupoA);
+            cout << "\n📊 ORIGEM MAIS PRÓXIMA DE CADA PESQUISADOR DO GRUPO DE DESTINO:\n";
+            cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+            int limite = min(20, static_cast<int>(grupoB.size()));
+            for (int i = 0; i < limite; i++) {
+                int id = grupoB[i];
+                cout << "  " << mappingPesquisadores->obterNomePorId(id) << " (ID: " << id << "): ";
+                if (todos.origemMaisProxima[id - 1] == -1) {
+                    cout << "∞\n";
+                } else {
+                    cout << setprecision(2) << todos.distancias[id - 1] << " a partir de "
+                         << mappingPesquisadores->obterNomePorId(todos.origemMaisProxima[id - 1]) << "\n";
+                }
+            }
+            if (static_cast<int>(grupoB.size()) > limite) {
+                cout << "  ... (mostrando apenas os primeiros " << limite << " pesquisadores)\n";
+            }
+        } catch (const exception& e) {
+            cout << "\n❌ Erro durante o cálculo: " << e.what() << "\n";
+        }
+    }
+
     void executarBusca() {
         limparTela();
         mostrarCabecalho();
@@ -680,17 +1317,53 @@ private:
         pausar();
     }
     
-    void executarDijkstra() {
-        cout << "\n👉 Digite o vértice de origem (1 a " << numVertices << "): ";
-        int origem;
-        cin >> origem;
-        
-        if (origem < 1 || origem > numVertices) {
-            cout << "❌ Vértice inválido!\n";
-            pausar();
-            return;
+    unique_ptr<IDijkstraStrategy> criarEstrategiaConfigurada() const {
+        if (tipoDijkstra == "vetor") {
+            return make_unique<DijkstraVetorStrategy>();
+        } else if (tipoDijkstra == "torneio") {
+            return make_unique<DijkstraTorneioStrategy>();
         }
-        
+        return make_unique<DijkstraHeapStrategy>();
+    }
+
+    // Pesos uniformes ou 0/1 dispensam a fila de prioridade; nos demais casos
+    // usa a matriz (se carregada) ou a estratégia configurada
+    // Consultas repetidas a partir da mesma origem saem do cache da sessão
+    ResultadoDijkstra executarCaminhosMinimos(int origem) {
+        ResultadoDijkstra resultado;
+        MotorCaminhos motor = Dijkstra::escolherMotor(*listaPeso);
+        bool usarMatriz = motor == MotorCaminhos::ESTRATEGIA && matrizPeso;
+        string estrategia = usarMatriz ? "matriz" : tipoDijkstra;
+
+        if (cacheDijkstra.obter(grafoSelecionado, origem, estrategia, resultado)) {
+            cout << "⚡ Árvore de caminhos mínimos reaproveitada do cache\n";
+            return resultado;
+        }
+
+        if (usarMatriz) {
+            cout << "🔍 Usando a matriz de adjacência com peso (relaxação "
+                 << OperacoesSIMD::conjuntoInstrucoes() << ")\n";
+            resultado = Dijkstra::dijkstraMatriz(*matrizPeso, origem);
+        } else {
+            cout << "🔍 Motor: " << Dijkstra::descreverMotor(motor, *listaPeso) << "\n";
+            resultado = Dijkstra::executarAutomatico(*listaPeso, origem, criarEstrategiaConfigurada());
+        }
+
+        cacheDijkstra.inserir(grafoSelecionado, estrategia, resultado);
+        return resultado;
+    }
+
+    void executarDijkstra() {
+        cout << "\n👉 Digite o vértice de origem (1 a " << numVertices << "): ";
+        int origem;
+        cin >> origem;
+        
+        if (origem < 1 || origem > numVertices) {
+            cout << "❌ Vértice inválido!\n";
+            pausar();
+            return;
+        }
+        
         cout << "\n🔍 Executando Dijkstra (" << tipoDijkstra << ")...\n";
         cout << "🔍 Debug: Vértice origem = " << origem << ", Num vértices = " << numVertices << "\n";
         
@@ -699,17 +1372,15 @@ private:
             
             cout << "🔍 Debug: Iniciando algoritmo...\n";
             
-            if (tipoDijkstra == "vetor") {
-                resultado = Dijkstra::dijkstraVetor(*listaPeso, origem);
-            } else {
-                resultado = Dijkstra::dijkstraHeap(*listaPeso, origem);
-            }
+            resultado = executarCaminhosMinimos(origem);
             
             cout << "🔍 Debug: Algoritmo concluído!\n";
             
             cout << "\n📊 RESULTADOS DO DIJKSTRA:\n";
             cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-            cout << "Origem: " << origem << "\n\n";
+            cout << "Origem: " << origem << "\n";
+            cacheDijkstra.imprimirEstatisticas();
+            cout << "\n";
             /*
             cout << "Distâncias mínimas:\n";
             for (int i = 1; i <= numVertices; i++) {
@@ -786,21 +1457,26 @@ private:
             return;
         }
         
-        cout << "🔍 Analisando estatísticas do grafo...\n\n";
+        // HyperANF é opcional: em grafos grandes domina o tempo da análise
+        cout << "👉 Estimar a distribuição de distâncias com HyperANF? (s/n): ";
+        char respostaHyperANF;
+        cin >> respostaHyperANF;
+        bool comHyperANF = respostaHyperANF == 's' || respostaHyperANF == 'S';
+        
+        cout << "\n🔍 Analisando estatísticas do grafo...\n\n";
         
         try {
             Estatisticas estatisticas(numVertices);
             
             if (tipoEstrutura == "matriz") {
                 MatrizAdjacenciaAdapter adapter(*matriz);
-                // Calcular número de arestas manualmente
+                // Arestas pelos graus guardados na matriz; laços ficam de fora, como no triângulo superior
                 int numArestas = 0;
                 const auto& mat = matriz->getMatriz();
                 for (int i = 0; i < numVertices; i++) {
-                    for (int j = i + 1; j < numVertices; j++) {
-                        if (mat[i][j] == 1) numArestas++;
-                    }
+                    numArestas += matriz->getGrau(i) - mat[i][i];
                 }
+                numArestas /= 2;
                 estatisticas.calcularEstatisticas(adapter, numArestas);
             } else {
                 ListaAdjacenciaAdapter adapter(*lista);
@@ -813,6 +1489,21 @@ private:
                 numArestas /= 2; // Grafo não direcionado
                 estatisticas.calcularEstatisticas(adapter, numArestas);
             }
+            estatisticas.adicionarInformacoesComponentes(*componentes);
+            DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+            GrafoCSR csr(dados);
+            if (comHyperANF) {
+                unique_ptr<HyperANF> hyperANF = executarHyperANF(csr);
+                if (hyperANF) {
+                    estatisticas.adicionarDistribuicaoDistancias(*hyperANF);
+                }
+            }
+            ContagemTriangulos triangulos;
+            triangulos.calcular(csr);
+            estatisticas.adicionarTriangulos(triangulos);
+            DecomposicaoNucleos nucleos;
+            nucleos.calcular(csr);
+            estatisticas.adicionarNucleos(nucleos);
             
             const EstatisticasGrafo& stats = estatisticas.getEstatisticas();
             
@@ -826,6 +1517,23 @@ private:
             cout << "🔸 Mediana do grau: " << fixed << setprecision(2) << stats.medianaGrau << "\n";
             cout << "🔸 Componentes conexas: " << stats.numComponentes << "\n";
             cout << "🔸 Grafo conexo: " << (stats.isConexo ? "✅ Sim" : "❌ Não") << "\n";
+            cout << "🔸 " << (stats.isConexo ? "Diâmetro" : "Maior distância finita") << ": " << stats.diametro
+                 << " (vértices " << stats.verticesDiametro.first << " e " << stats.verticesDiametro.second << ")\n";
+            cout << "🔸 Raio" << (stats.isConexo ? "" : " (maior componente)") << ": " << stats.raio
+                 << " (" << stats.centro.size() << " vértices no centro, " << stats.buscasExcentricidades << " BFS)\n";
+            if (stats.temDistribuicaoAproximada) {
+                cout << "🔸 Distância média (HyperANF): " << fixed << setprecision(3) << stats.distanciaMedia
+                     << " ± " << stats.desvioDistanciaMedia << "\n";
+                cout << "🔸 Diâmetro efetivo (HyperANF, 90%): " << stats.diametroEfetivo
+                     << " ± " << stats.desvioDiametroEfetivo << "\n";
+            }
+            cout << "🔸 Triângulos: " << stats.numTriangulos << " (" << setprecision(3)
+                 << triangulos.getTempoMs() << " ms, interseção " << OperacoesSIMD::conjuntoInstrucoes() << ")\n";
+            cout << "🔸 Coeficiente de agrupamento médio: " << setprecision(4) << stats.coeficienteAgrupamentoMedio
+                 << " (transitividade " << stats.transitividade << ")\n";
+            cout << "🔸 Degeneração (maior k-núcleo): " << stats.degeneracao << " ("
+                 << stats.tamanhosKNucleos[stats.degeneracao] << " vértices, " << setprecision(3)
+                 << nucleos.getTempoMs() << " ms)\n";
             
             if (stats.numComponentes > 1) {
                 cout << "🔸 Maior componente: " << stats.maiorComponente << " vértices\n";
@@ -849,12 +1557,31 @@ private:
                 int limite = min(20, static_cast<int>(stats.graus.size()));
                 cout << "Primeiros " << limite << " vértices:\n";
                 for (int i = 0; i < limite; i++) {
-                    cout << "  Vértice " << setw(3) << (i + 1) << ": grau " << stats.graus[i] << "\n";
+                    cout << "  Vértice " << setw(3) << (i + 1) << ": grau " << stats.graus[i]
+                         << ", " << stats.triangulosPorVertice[i] << " triângulos, agrupamento "
+                         << setprecision(4) << stats.coeficientesAgrupamento[i]
+                         << ", núcleo " << stats.nucleos[i] << "\n";
                 }
                 
                 if (stats.graus.size() > 20) {
                     cout << "  ... (total de " << stats.graus.size() << " vértices)\n";
                 }
+
+                cout << "\n🧅 K-NÚCLEOS (núcleo: vértices | tamanho do k-núcleo):\n";
+                for (size_t k = 0; k < stats.verticesPorNucleo.size(); k++) {
+                    if (stats.verticesPorNucleo[k] > 0) {
+                        cout << "  " << setw(3) << k << ": " << stats.verticesPorNucleo[k]
+                             << " | " << stats.tamanhosKNucleos[k] << "\n";
+                    }
+                }
+            }
+
+            // Buscas e distâncias de referência, agendadas para dividir as BFS
+            cout << "\n👉 Executar a análise completa (BFS/DFS compartilhadas, tempo por fase)? (s/n): ";
+            cin >> resposta;
+            if (resposta == 's' || resposta == 'S') {
+                unique_ptr<IGrafo> adapter = criarAdapterSemPeso();
+                estatisticas.executarAnaliseCompleta(*adapter);
             }
             
         } catch (const exception& e) {
@@ -885,8 +1612,14 @@ private:
         
         cout << "Escolha o tipo de análise:\n\n";
         cout << "1. Distância entre dois vértices específicos\n";
-        cout << "2. Calcular diâmetro do grafo (aproximado)\n";
+        cout << "2. Calcular diâmetro do grafo (exato, iFUB)\n";
         cout << "3. Distâncias a partir de um vértice\n";
+        cout << "4. Construir índice de rótulos podados (consultas exatas rápidas)\n";
+        cout << "5. Comparar índice de rótulos x BFS em consultas aleatórias\n";
+        cout << "6. Distâncias a partir de um conjunto de vértices (BFS multi-origem)\n";
+        cout << "7. Distribuição de distâncias aproximada (HyperANF, grafos grandes)\n";
+        cout << "8. Gravar matriz de distâncias completa (BFS paralela, arquivo binário)\n";
+        cout << "9. Centralidade: intermediação, proximidade e harmônica (top-k)\n";
         cout << "0. Voltar\n\n";
         cout << "👉 Digite sua escolha: ";
         
@@ -914,7 +1647,10 @@ private:
                     }
                     
                     int dist;
-                    if (tipoEstrutura == "matriz") {
+                    if (rotulosDisponiveis()) {
+                        dist = rotulos->consultar(origem, destino);
+                        cout << "\n⚡ Usando índice de rótulos podados";
+                    } else if (tipoEstrutura == "matriz") {
                         MatrizAdjacenciaAdapter adapter(*matriz);
                         dist = distancias.calcularDistanciaEspecifica(adapter, origem, destino);
                     } else {
@@ -934,13 +1670,7 @@ private:
                 case 2: {
                     cout << "\n🔍 Calculando estatísticas de distâncias...\n";
                     
-                    if (tipoEstrutura == "matriz") {
-                        MatrizAdjacenciaAdapter adapter(*matriz);
-                        distancias.calcularDistancias(adapter);
-                    } else {
-                        ListaAdjacenciaAdapter adapter(*lista);
-                        distancias.calcularDistancias(adapter);
-                    }
+                    distancias.calcularDiametroExato(*criarAdapterSemPeso());
                     
                     int diametro = distancias.getDiametro();
                     pair<int, int> vertices = distancias.getVerticesDiametro();
@@ -994,6 +1724,39 @@ private:
                     break;
                 }
                 
+                case 4:
+                    construirRotulos();
+                    break;
+                
+                case 5:
+                    if (rotulosDisponiveis() || construirRotulos()) {
+                        compararRotulosComBFS();
+                    }
+                    break;
+
+                case 6:
+                    analisarDistanciasMultiOrigem();
+                    break;
+
+                case 7:
+                    estimarDistribuicaoDistancias();
+                    break;
+
+                case 8: {
+                    string arquivoMatriz = "grafos/" + grafoSelecionado + ".dist";
+                    DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+                    GrafoCSR csr(dados);
+                    cout << "\n";
+                    distancias.salvarResultado(csr, arquivoMatriz);
+                    cout << "\n";
+                    distancias.imprimirMatrizDistancias(arquivoMatriz, 10);
+                    break;
+                }
+
+                case 9:
+                    rankingCentralidade();
+                    break;
+                
                 default:
                     cout << "❌ Opção inválida!\n";
                     break;
@@ -1006,6 +1769,205 @@ private:
         pausar();
     }
     
+    vector<int> lerConjuntoVertices(const string& descricao) {
+        cout << "👉 " << descricao << " (1 a " << numVertices << ", separados por espaço): ";
+        string linha;
+        getline(cin, linha);
+
+        vector<int> vertices;
+        stringstream ss(linha);
+        int v;
+        while (ss >> v) {
+            vertices.push_back(v);
+        }
+        return vertices;
+    }
+
+    void analisarDistanciasMultiOrigem() {
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        vector<int> origens = lerConjuntoVertices("Vértices de origem");
+        if (origens.empty()) {
+            cout << "❌ Nenhum vértice de origem informado!\n";
+            return;
+        }
+        vector<int> destinos = lerConjuntoVertices("Vértices de destino, vazio para pular");
+
+        unique_ptr<IGrafo> adapter = criarAdapterSemPeso();
+
+        if (!destinos.empty()) {
+            ResultadoEntreConjuntos par = MultiplasOrigens::bfsEntreConjuntos(*adapter, origens, destinos);
+            cout << "\n📏 Menor distância entre os conjuntos: ";
+            if (par.destino == -1) {
+                cout << "∞ (conjuntos não conectados)\n";
+            } else {
+                cout << static_cast<int>(par.distancia) << " (" << par.origem << " → " << par.destino << ", "
+                     << par.verticesFechados << " vértices visitados antes da parada)\n";
+            }
+        }
+
+        ResultadoMultiplasOrigens resultado = MultiplasOrigens::bfs(*adapter, origens);
+
+        cout << "\n📊 DISTÂNCIAS ATÉ A ORIGEM MAIS PRÓXIMA:\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+        int limite = min(50, numVertices);
+        for (int i = 0; i < limite; i++) {
+            cout << "  Para vértice " << setw(3) << i + 1 << ": ";
+            if (resultado.origemMaisProxima[i] == -1) {
+                cout << "∞\n";
+            } else {
+                cout << static_cast<int>(resultado.distancias[i]) << " (origem " << resultado.origemMaisProxima[i] << ")\n";
+            }
+        }
+
+        if (numVertices > 50) {
+            cout << "  ... (mostrando apenas os primeiros 50 vértices)\n";
+        }
+    }
+
+    // nullptr se os contadores passarem do limite de memória
+    unique_ptr<HyperANF> executarHyperANF(const GrafoCSR& csr) {
+        size_t memoria = HyperANF::memoriaNecessaria(csr.getNumVertices(), precisaoHyperANF);
+        if (memoria > LIMITE_CONTADORES_HYPERANF_BYTES) {
+            cout << "⚠️  Os contadores do HyperANF ocupariam " << memoria / (1024 * 1024)
+                 << " MB com precisão " << precisaoHyperANF << "; use uma precisão menor\n";
+            return nullptr;
+        }
+        auto hyperANF = make_unique<HyperANF>(precisaoHyperANF);
+        hyperANF->calcular(csr);
+        return hyperANF;
+    }
+
+    void estimarDistribuicaoDistancias() {
+        cout << "\n👉 Precisão (log2 dos registradores, " << HyperANF::PRECISAO_MINIMA << " a "
+             << HyperANF::PRECISAO_MAXIMA << "; atual " << precisaoHyperANF << "): ";
+        int precisao;
+        cin >> precisao;
+        if (precisao < HyperANF::PRECISAO_MINIMA || precisao > HyperANF::PRECISAO_MAXIMA) {
+            cout << "❌ Precisão inválida!\n";
+            return;
+        }
+        size_t memoria = HyperANF::memoriaNecessaria(numVertices, precisao);
+        if (memoria > LIMITE_CONTADORES_HYPERANF_BYTES) {
+            cout << "❌ Os contadores ocupariam " << memoria / (1024 * 1024)
+                 << " MB; use uma precisão menor neste grafo\n";
+            return;
+        }
+        precisaoHyperANF = precisao;
+
+        cout << "\n🔄 Executando HyperANF...\n";
+        DadosGrafo dados = LeitorGrafo::lerArquivo("grafos/" + grafoSelecionado);
+        GrafoCSR csr(dados);
+        unique_ptr<HyperANF> hyperANF = executarHyperANF(csr);
+        if (!hyperANF) {
+            return;
+        }
+        vector<double> pares = hyperANF->getParesPorDistancia();
+
+        cout << "\n📊 DISTRIBUIÇÃO DE DISTÂNCIAS (estimada):\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        cout << fixed << setprecision(0);
+        for (size_t t = 1; t < pares.size(); t++) {
+            cout << "  Distância " << setw(3) << t << ": " << setw(14) << pares[t] << " pares\n";
+        }
+        cout << "\n🔸 Pares conectados: " << hyperANF->getParesAlcancaveis()
+             << " (desvio relativo <= " << setprecision(1) << 100.0 * hyperANF->getErroRelativo() << "%)\n";
+        cout << setprecision(3);
+        cout << "🔸 Distância média: " << hyperANF->getDistanciaMedia()
+             << " ± " << hyperANF->getDesvioDistanciaMedia() << "\n";
+        cout << "🔸 Diâmetro efetivo (90%): " << hyperANF->getDiametroEfetivo()
+             << " ± " << hyperANF->getDesvioDiametroEfetivo() << "\n";
+        cout << "🔸 Diâmetro >= " << hyperANF->getNumIteracoes() << " (iterações até estabilizar)\n";
+        cout << "🔸 " << hyperANF->getNumRegistradores() << " registradores por contador, "
+             << hyperANF->getRepeticoes() << " repetições, " << hyperANF->getNumThreads() << " threads, "
+             << OperacoesSIMD::conjuntoInstrucoes() << "\n";
+        cout << "⏱️  Tempo: " << hyperANF->getTempoMs() << " ms (" << setprecision(1)
+             << hyperANF->getMemoriaBytes() / (1024.0 * 1024.0) << " MB de contadores)\n";
+    }
+
+    unique_ptr<IGrafo> criarAdapterSemPeso() const {
+        if (tipoEstrutura == "matriz") {
+            return make_unique<MatrizAdjacenciaAdapter>(*matriz);
+        }
+        return make_unique<ListaAdjacenciaAdapter>(*lista);
+    }
+
+    bool construirRotulos() {
+        string arquivoIndice = RotulacaoPodada::caminhoArquivoIndice("grafos/" + grafoSelecionado);
+        unique_ptr<IGrafo> adapter = criarAdapterSemPeso();
+        rotulos = make_unique<RotulacaoPodada>(numVertices);
+
+        cout << "\n⏳ Construindo índice de rótulos podados...\n";
+        rotulos->construir(*adapter);
+        rotulos->salvarEmArquivo(arquivoIndice);
+        grafoRotulos = grafoSelecionado;
+
+        cout << "✅ Índice salvo em '" << arquivoIndice << "'\n";
+        rotulos->imprimirResumo();
+        return true;
+    }
+
+    // Usa o índice salvo em disco, se existir, sem construí-lo
+    bool rotulosDisponiveis() {
+        if (rotulos && grafoRotulos == grafoSelecionado) {
+            return true;
+        }
+
+        auto candidato = make_unique<RotulacaoPodada>(numVertices);
+        string arquivoIndice = RotulacaoPodada::caminhoArquivoIndice("grafos/" + grafoSelecionado);
+        unique_ptr<IGrafo> adapter = criarAdapterSemPeso();
+        if (!candidato->carregarDeArquivo(arquivoIndice, *adapter)) {
+            return false;
+        }
+
+        rotulos = move(candidato);
+        grafoRotulos = grafoSelecionado;
+        return true;
+    }
+
+    void compararRotulosComBFS() {
+        cout << "\n👉 Número de consultas aleatórias (ex: 100): ";
+        int q;
+        cin >> q;
+        if (q <= 0) {
+            cout << "❌ Número inválido!\n";
+            return;
+        }
+
+        vector<int> origens = gerarVerticesAleatorios(q, numVertices);
+        vector<int> destinos = gerarVerticesAleatorios(q, numVertices);
+        unique_ptr<IGrafo> adapter = criarAdapterSemPeso();
+        Distancias distancias(numVertices);
+
+        double tempoRotulos = 0.0;
+        double tempoBFS = 0.0;
+        int divergencias = 0;
+
+        for (int i = 0; i < q; i++) {
+            auto inicio = chrono::high_resolution_clock::now();
+            int distIndice = rotulos->consultar(origens[i], destinos[i]);
+            auto meio = chrono::high_resolution_clock::now();
+            int distBFS = distancias.getDistancia(*adapter, origens[i], destinos[i]);
+            auto fim = chrono::high_resolution_clock::now();
+
+            tempoRotulos += chrono::duration_cast<chrono::nanoseconds>(meio - inicio).count() / 1e6;
+            tempoBFS += chrono::duration_cast<chrono::microseconds>(fim - meio).count() / 1000.0;
+
+            if (distIndice != distBFS) {
+                divergencias++;
+            }
+        }
+
+        cout << "\n📊 RÓTULOS PODADOS x BFS (" << q << " consultas):\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        cout << fixed << setprecision(3);
+        cout << "🔸 Tempo médio com índice: " << (tempoRotulos / q) * 1000.0 << " µs\n";
+        cout << "🔸 Tempo médio BFS: " << tempoBFS / q << " ms\n";
+        cout << "🔸 Speedup: " << setprecision(2)
+             << (tempoRotulos > 0 ? tempoBFS / tempoRotulos : 0.0) << "x\n";
+        cout << "🔸 Resultados divergentes: " << divergencias << "\n";
+    }
+    
     void benchmarkDijkstra() {
         limparTela();
         mostrarCabecalho();
@@ -1048,6 +2010,8 @@ private:
             // Executar benchmark para ambas as implementações
             double tempoVetor = executarBenchmarkDijkstra(verticesOrigem, "vetor");
             double tempoHeap = executarBenchmarkDijkstra(verticesOrigem, "heap");
+            double tempoTorneio = executarBenchmarkDijkstra(verticesOrigem, "torneio");
+            double tempoMatriz = matrizPeso ? executarBenchmarkDijkstra(verticesOrigem, "matriz") : 0.0;
             
             // Calcular médias
             double mediaVetor = tempoVetor / k;
@@ -1055,6 +2019,13 @@ private:
             
             // Mostrar resultados em tabela
             mostrarResultadosBenchmark(tempoVetor, tempoHeap, mediaVetor, mediaHeap, k);
+            mostrarResultadoTorneio(tempoTorneio, tempoVetor, tempoHeap, k);
+            if (matrizPeso) {
+                mostrarResultadoMatriz(tempoMatriz, tempoHeap, k);
+            }
+            
+            // Mesmas origens no executor paralelo, reduzindo cada resultado
+            executarBenchmarkParalelo(verticesOrigem, tempoHeap);
             
         } catch (const exception& e) {
             cout << "❌ Erro durante o benchmark: " << e.what() << "\n";
@@ -1087,6 +2058,10 @@ private:
             // Executar Dijkstra
             if (tipo == "vetor") {
                 Dijkstra::dijkstraVetor(*listaPeso, vertice);
+            } else if (tipo == "torneio") {
+                Dijkstra::dijkstraTorneio(*listaPeso, vertice);
+            } else if (tipo == "matriz") {
+                Dijkstra::dijkstraMatriz(*matrizPeso, vertice);
             } else {
                 Dijkstra::dijkstraHeap(*listaPeso, vertice);
             }
@@ -1099,6 +2074,75 @@ private:
         return tempoTotal;
     }
     
+    void executarBenchmarkParalelo(const vector<int>& vertices, double tempoHeapSerial) {
+        ListaAdjacenciaPesoAdapter adapter(*listaPeso);
+        // Usa a estratégia configurada; heap quando nada foi configurado
+        string estrategia = (tipoDijkstra == "vetor" || tipoDijkstra == "torneio") ? tipoDijkstra : "heap";
+        FabricaEstrategiaDijkstra fabrica = [estrategia]() -> unique_ptr<IDijkstraStrategy> {
+            if (estrategia == "vetor") {
+                return make_unique<DijkstraVetorStrategy>();
+            }
+            if (estrategia == "torneio") {
+                return make_unique<DijkstraTorneioStrategy>();
+            }
+            return make_unique<DijkstraHeapStrategy>();
+        };
+        DijkstraParalelo paralelo(0, fabrica);
+        
+        cout << "\n🔄 Testando Dijkstra paralelo (" << estrategia << ", "
+             << paralelo.getNumThreads() << " threads)...\n";
+        
+        auto inicio = chrono::high_resolution_clock::now();
+        vector<ResumoOrigem> resumos = paralelo.calcularResumos(adapter, vertices);
+        auto fim = chrono::high_resolution_clock::now();
+        double tempoParalelo = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+        
+        double maiorExcentricidade = 0.0;
+        double somaProximidade = 0.0;
+        const ResumoOrigem* maisCentral = nullptr;
+        for (const auto& resumo : resumos) {
+            maiorExcentricidade = max(maiorExcentricidade, resumo.excentricidade);
+            somaProximidade += resumo.proximidade;
+            if (!maisCentral || resumo.proximidade > maisCentral->proximidade) {
+                maisCentral = &resumo;
+            }
+        }
+        
+        cout << "\n⚡ EXECUÇÃO PARALELA:\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        cout << fixed << setprecision(3);
+        cout << "🔸 Tempo total (relógio): " << tempoParalelo << " ms\n";
+        cout << "🔸 Tempo médio por origem: " << tempoParalelo / vertices.size() << " ms\n";
+        cout << "🔸 Speedup sobre o Heap sequencial: " << setprecision(2)
+             << (tempoParalelo > 0 ? tempoHeapSerial / tempoParalelo : 0.0) << "x\n";
+        cout << "🔸 Maior excentricidade entre as origens: " << maiorExcentricidade << "\n";
+        cout << "🔸 Closeness médio: " << setprecision(6)
+             << somaProximidade / resumos.size() << "\n";
+        if (maisCentral) {
+            cout << "🔸 Origem mais central: " << maisCentral->origem
+                 << " (closeness " << maisCentral->proximidade << ")\n";
+        }
+    }
+    
+    void mostrarResultadoTorneio(double tempoTorneio, double tempoVetor, double tempoHeap, int k) {
+        cout << "\n🌳 VETOR COM ÁRVORE DE TORNEIO (" << OperacoesSIMD::conjuntoInstrucoes() << "):\n";
+        cout << "🔸 Tempo total: " << fixed << setprecision(3) << tempoTorneio << " ms"
+             << " (médio: " << tempoTorneio / k << " ms)\n";
+        if (tempoTorneio > 0) {
+            cout << "🔸 " << setprecision(2) << tempoVetor / tempoTorneio << "x em relação ao Vetor, "
+                 << tempoHeap / tempoTorneio << "x em relação ao Heap\n";
+        }
+    }
+    
+    void mostrarResultadoMatriz(double tempoMatriz, double tempoHeap, int k) {
+        cout << "\n🧮 MATRIZ DE ADJACÊNCIA COM PESO (relaxação " << OperacoesSIMD::conjuntoInstrucoes() << "):\n";
+        cout << "🔸 Tempo total: " << fixed << setprecision(3) << tempoMatriz << " ms"
+             << " (médio: " << tempoMatriz / k << " ms)\n";
+        if (tempoMatriz > 0) {
+            cout << "🔸 " << setprecision(2) << tempoHeap / tempoMatriz << "x em relação ao Heap sobre a lista\n";
+        }
+    }
+    
     void mostrarResultadosBenchmark(double tempoVetor, double tempoHeap, 
                                   double mediaVetor, double mediaHeap, int k) {
         cout << "\n📊 RESULTADOS DO BENCHMARK DIJKSTRA:\n";
@@ -1148,6 +2192,427 @@ private:
         }
     }
     
+    void consultasAceleradas() {
+        limparTela();
+        mostrarCabecalho();
+
+        cout << "┌─────────────────────────────────────────────────────────────┐\n";
+        cout << "│           CONSULTAS PONTO-A-PONTO ACELERADAS               │\n";
+        cout << "└─────────────────────────────────────────────────────────────┘\n\n";
+
+        if (!grafoPeso) {
+            cout << "❌ Esta funcionalidade está disponível apenas para grafos com peso!\n";
+            pausar();
+            return;
+        }
+
+        if (!carregarGrafo()) {
+            pausar();
+            return;
+        }
+
+        cout << "\nEscolha a operação:\n\n";
+        cout << "1. Preparar marcos ALT (reutiliza arquivo salvo, se houver)\n";
+        cout << "2. Consultar caminho com ALT (A* + marcos)\n";
+        cout << "3. Comparar ALT x Dijkstra em consultas aleatórias\n";
+        cout << "4. Preparar hierarquia de contração (reutiliza arquivo salvo, se houver)\n";
+        cout << "5. Consultar caminho com hierarquia de contração\n";
+        cout << "6. Comparar hierarquia de contração x Dijkstra\n";
+        cout << "7. Calcular distâncias entre todos os pares (Floyd-Warshall blocado)\n";
+        cout << "8. Consultar distância na tabela de todos os pares (O(1))\n";
+        cout << "9. Alterar arestas: reparo incremental x recomputação do Dijkstra\n";
+        cout << "0. Voltar\n\n";
+        cout << "👉 Digite sua escolha: ";
+
+        int escolha;
+        cin >> escolha;
+
+        try {
+            switch (escolha) {
+                case 1:
+                    prepararALT(true);
+                    break;
+                case 2:
+                    if (prepararALT(false)) {
+                        consultarCaminhoAcelerado("ALT", [this](int s, int t) {
+                            ResultadoConsultaALT r = alt->consultar(*listaPeso, s, t);
+                            return make_tuple(r.distancia, r.caminho, r.verticesVisitados);
+                        });
+                    }
+                    break;
+                case 3:
+                    if (prepararALT(false)) {
+                        compararComDijkstra("ALT", [this](int s, int t) {
+                            ResultadoConsultaALT r = alt->consultar(*listaPeso, s, t);
+                            return make_tuple(r.distancia, r.caminho, r.verticesVisitados);
+                        });
+                    }
+                    break;
+                case 4:
+                    prepararHierarquia(true);
+                    break;
+                case 5:
+                    if (prepararHierarquia(false)) {
+                        consultarCaminhoAcelerado("CH", [this](int s, int t) {
+                            ResultadoConsultaCH r = hierarquia->consultar(s, t);
+                            return make_tuple(r.distancia, r.caminho, r.verticesVisitados);
+                        });
+                    }
+                    break;
+                case 6:
+                    if (prepararHierarquia(false)) {
+                        compararComDijkstra("CH", [this](int s, int t) {
+                            ResultadoConsultaCH r = hierarquia->consultar(s, t);
+                            return make_tuple(r.distancia, r.caminho, r.verticesVisitados);
+                        });
+                    }
+                    break;
+                case 7:
+                    prepararTodosPares(true);
+                    break;
+                case 8:
+                    if (prepararTodosPares(false)) {
+                        consultarTodosPares();
+                    }
+                    break;
+                case 9:
+                    compararReparoIncremental();
+                    break;
+                case 0:
+                    return;
+                default:
+                    cout << "❌ Opção inválida!\n";
+                    break;
+            }
+        } catch (const exception& e) {
+            cout << "❌ Erro durante a consulta: " << e.what() << "\n";
+        }
+
+        pausar();
+    }
+
+    bool prepararALT(bool forcarConfiguracao) {
+        if (alt && grafoALT == grafoSelecionado && !forcarConfiguracao) {
+            return true;
+        }
+
+        string arquivoMarcos = ALT::caminhoArquivoMarcos("grafos/" + grafoSelecionado);
+        alt = make_unique<ALT>(numVertices);
+
+        if (!forcarConfiguracao && alt->carregarDeArquivo(arquivoMarcos, *listaPeso)) {
+            grafoALT = grafoSelecionado;
+            cout << "\n✅ Marcos carregados de '" << arquivoMarcos << "'\n";
+            alt->imprimirResumo();
+            return true;
+        }
+
+        cout << "\n👉 Número de marcos (ex: 16): ";
+        int k;
+        cin >> k;
+        if (k < 1 || k > numVertices) {
+            cout << "❌ Número inválido! Deve ser entre 1 e " << numVertices << "\n";
+            alt.reset();
+            return false;
+        }
+
+        cout << "👉 Heurística (1 = mais distante, 2 = evitar): ";
+        int h;
+        cin >> h;
+        HeuristicaMarcos heuristica = (h == 1) ? HeuristicaMarcos::DISTANTE : HeuristicaMarcos::EVITAR;
+
+        cout << "\n⏳ Pré-processando " << k << " marcos...\n";
+        alt->preprocessar(*listaPeso, k, heuristica);
+        alt->salvarEmArquivo(arquivoMarcos);
+        grafoALT = grafoSelecionado;
+
+        cout << "✅ Marcos salvos em '" << arquivoMarcos << "'\n";
+        alt->imprimirResumo();
+        return true;
+    }
+
+    bool prepararHierarquia(bool reconstruir) {
+        if (hierarquia && grafoHierarquia == grafoSelecionado && !reconstruir) {
+            return true;
+        }
+
+        string arquivoHierarquia = HierarquiaContracao::caminhoArquivoHierarquia("grafos/" + grafoSelecionado);
+        hierarquia = make_unique<HierarquiaContracao>(numVertices);
+
+        if (!reconstruir && hierarquia->carregarDeArquivo(arquivoHierarquia, *listaPeso)) {
+            grafoHierarquia = grafoSelecionado;
+            cout << "\n✅ Hierarquia carregada de '" << arquivoHierarquia << "'\n";
+            hierarquia->imprimirResumo();
+            return true;
+        }
+
+        cout << "\n⏳ Construindo hierarquia de contração...\n";
+        hierarquia->construir(*listaPeso);
+        hierarquia->salvarEmArquivo(arquivoHierarquia);
+        grafoHierarquia = grafoSelecionado;
+
+        cout << "✅ Hierarquia salva em '" << arquivoHierarquia << "'\n";
+        hierarquia->imprimirResumo();
+        return true;
+    }
+
+    bool prepararTodosPares(bool recalcular) {
+        if (todosPares && grafoTodosPares == grafoSelecionado && !recalcular) {
+            return true;
+        }
+
+        size_t memoria = TodosPares::memoriaNecessaria(numVertices);
+        if (memoria > LIMITE_MATRIZ_PESO_BYTES) {
+            cout << "\n❌ A tabela ocuparia " << memoria / (1024 * 1024)
+                 << " MB; use ALT ou hierarquia de contração neste grafo\n";
+            return false;
+        }
+
+        string arquivoDistancias = TodosPares::caminhoArquivoDistancias("grafos/" + grafoSelecionado);
+        ListaAdjacenciaPesoAdapter adapter(*listaPeso);
+        todosPares = make_unique<TodosPares>(numVertices);
+
+        if (!recalcular && todosPares->carregarDeArquivo(arquivoDistancias, adapter)) {
+            grafoTodosPares = grafoSelecionado;
+            cout << "\n✅ Tabela carregada de '" << arquivoDistancias << "'\n";
+            todosPares->imprimirResumo();
+            return true;
+        }
+
+        cout << "\n⏳ Calculando distâncias entre todos os pares...\n";
+        todosPares->calcular(adapter);
+        todosPares->salvarEmArquivo(arquivoDistancias);
+        grafoTodosPares = grafoSelecionado;
+
+        cout << "✅ Tabela salva em '" << arquivoDistancias << "'\n";
+        todosPares->imprimirResumo();
+        return true;
+    }
+
+    void consultarTodosPares() {
+        cout << "\n👉 Digite o vértice de origem (1 a " << numVertices << "): ";
+        int origem;
+        cin >> origem;
+        cout << "👉 Digite o vértice destino (1 a " << numVertices << "): ";
+        int destino;
+        cin >> destino;
+
+        if (origem < 1 || origem > numVertices || destino < 1 || destino > numVertices) {
+            cout << "❌ Vértices inválidos!\n";
+            return;
+        }
+
+        auto inicio = chrono::high_resolution_clock::now();
+        double distancia = todosPares->consultar(origem, destino);
+        auto fim = chrono::high_resolution_clock::now();
+        double tempoUs = chrono::duration_cast<chrono::nanoseconds>(fim - inicio).count() / 1000.0;
+
+        if (distancia == INF) {
+            cout << "\n❌ Vértice " << destino << " não é acessível a partir de " << origem << "\n";
+            return;
+        }
+
+        cout << "\n📏 Distância de " << origem << " para " << destino << ": "
+             << fixed << setprecision(2) << distancia << "\n";
+        cout << "⏱️  Tempo da consulta: " << setprecision(3) << tempoUs << " µs\n";
+    }
+
+    // Lote aleatório: remoções, aumentos e reduções de peso de arestas
+    // existentes e inserções de arestas novas, em proporções iguais
+    vector<AlteracaoAresta> gerarAlteracoesAleatorias(const ListaAdjacenciaPeso& grafo, int m) {
+        random_device rd;
+        mt19937 gen(rd());
+        uniform_int_distribution<> disVertice(0, numVertices - 1);
+        uniform_int_distribution<> disTipo(0, 3);
+        uniform_real_distribution<> disPeso(0.01, 10.0);
+
+        const auto& L = grafo.getLista();
+        vector<AlteracaoAresta> alteracoes;
+        for (int i = 0; i < m; i++) {
+            int u = disVertice(gen);
+            int tipo = disTipo(gen);
+
+            if (tipo == 3 || L[u].empty()) {
+                alteracoes.push_back({TipoAlteracao::INSERIR, u + 1, disVertice(gen) + 1, disPeso(gen)});
+                continue;
+            }
+
+            uniform_int_distribution<> disVizinho(0, L[u].size() - 1);
+            auto [v, peso] = L[u][disVizinho(gen)];
+            if (tipo == 0) {
+                alteracoes.push_back({TipoAlteracao::REMOVER, u + 1, v, 0.0});
+            } else {
+                double novoPeso = (tipo == 1) ? peso * 2 : peso / 2;
+                alteracoes.push_back({TipoAlteracao::ALTERAR_PESO, u + 1, v, novoPeso});
+            }
+        }
+        return alteracoes;
+    }
+
+    void compararReparoIncremental() {
+        cout << "\n👉 Número de origens com resultado em cache (ex: 20): ";
+        int k;
+        cin >> k;
+        cout << "👉 Número de alterações de arestas no lote (ex: 10): ";
+        int m;
+        cin >> m;
+        if (k <= 0 || m <= 0) {
+            cout << "❌ Número inválido!\n";
+            return;
+        }
+
+        // As alterações são feitas numa cópia: marcos, hierarquia e tabelas
+        // salvos continuam valendo para o grafo carregado
+        ListaAdjacenciaPeso copia = *listaPeso;
+        vector<int> origens = gerarVerticesAleatorios(k, numVertices);
+
+        cout << "\n⏳ Calculando " << k << " resultados iniciais...\n";
+        vector<ResultadoDijkstra> resultados;
+        for (int origem : origens) {
+            resultados.push_back(Dijkstra::dijkstraHeap(copia, origem));
+        }
+
+        vector<AlteracaoAresta> alteracoes = gerarAlteracoesAleatorias(copia, m);
+        DijkstraDinamico::aplicarAlteracoes(copia, alteracoes);
+
+        double tempoReparo = 0.0;
+        double tempoRecomputo = 0.0;
+        long long invalidados = 0;
+        long long reprocessados = 0;
+        int divergencias = 0;
+
+        for (auto& resultado : resultados) {
+            EstatisticasReparo estatisticas = DijkstraDinamico::reparar(copia, resultado, alteracoes);
+            tempoReparo += estatisticas.tempoMs;
+            invalidados += estatisticas.verticesInvalidados;
+            reprocessados += estatisticas.verticesReprocessados;
+
+            auto inicio = chrono::high_resolution_clock::now();
+            ResultadoDijkstra completo = Dijkstra::dijkstraHeap(copia, resultado.origem);
+            auto fim = chrono::high_resolution_clock::now();
+            tempoRecomputo += chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+
+            for (int v = 0; v < numVertices; v++) {
+                double esperado = completo.distancias[v];
+                double obtido = resultado.distancias[v];
+                if (!(obtido == esperado || abs(obtido - esperado) < 1e-9)) {
+                    divergencias++;
+                    break;
+                }
+            }
+        }
+
+        cout << "\n📊 REPARO INCREMENTAL x RECOMPUTAÇÃO (" << k << " origens, "
+             << m << " alterações):\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        cout << fixed << setprecision(3);
+        cout << "🔸 Tempo médio do reparo: " << tempoReparo / k << " ms\n";
+        cout << "🔸 Tempo médio da recomputação (heap): " << tempoRecomputo / k << " ms\n";
+        cout << "🔸 Speedup: " << setprecision(2)
+             << (tempoReparo > 0 ? tempoRecomputo / tempoReparo : 0.0) << "x\n";
+        cout << "🔸 Vértices invalidados por origem: " << invalidados / k
+             << " | reprocessados: " << reprocessados / k << " de " << numVertices << "\n";
+        cout << "🔸 Resultados divergentes: " << divergencias << "\n";
+    }
+
+    // Usa a hierarquia salva em disco, se existir, sem construí-la
+    bool hierarquiaDisponivel() {
+        if (hierarquia && grafoHierarquia == grafoSelecionado) {
+            return true;
+        }
+
+        auto candidata = make_unique<HierarquiaContracao>(numVertices);
+        string arquivoHierarquia = HierarquiaContracao::caminhoArquivoHierarquia("grafos/" + grafoSelecionado);
+        if (!candidata->carregarDeArquivo(arquivoHierarquia, *listaPeso)) {
+            return false;
+        }
+
+        hierarquia = move(candidata);
+        grafoHierarquia = grafoSelecionado;
+        return true;
+    }
+
+    // consulta(origem, destino) -> (distância, caminho em base 1, vértices visitados)
+    typedef function<tuple<double, vector<int>, int>(int, int)> ConsultaPontoAPonto;
+
+    void consultarCaminhoAcelerado(const string& nome, const ConsultaPontoAPonto& consulta) {
+        cout << "\n👉 Digite o vértice de origem (1 a " << numVertices << "): ";
+        int origem;
+        cin >> origem;
+        cout << "👉 Digite o vértice destino (1 a " << numVertices << "): ";
+        int destino;
+        cin >> destino;
+
+        if (origem < 1 || origem > numVertices || destino < 1 || destino > numVertices) {
+            cout << "❌ Vértices inválidos!\n";
+            return;
+        }
+
+        auto inicio = chrono::high_resolution_clock::now();
+        auto [distancia, caminho, visitados] = consulta(origem, destino);
+        auto fim = chrono::high_resolution_clock::now();
+        double tempoMs = chrono::duration_cast<chrono::microseconds>(fim - inicio).count() / 1000.0;
+
+        if (caminho.empty()) {
+            cout << "\n❌ Vértice " << destino << " não é acessível a partir de " << origem << "\n";
+            return;
+        }
+
+        cout << "\n📍 Caminho de " << origem << " para " << destino << " (" << nome << "):\n";
+        for (size_t i = 0; i < caminho.size(); i++) {
+            cout << caminho[i];
+            if (i < caminho.size() - 1) cout << " → ";
+        }
+        cout << "\n📏 Distância total: " << fixed << setprecision(2) << distancia << "\n";
+        cout << "🔸 Vértices visitados: " << visitados << " de " << numVertices << "\n";
+        cout << "⏱️  Tempo da consulta: " << setprecision(3) << tempoMs << " ms\n";
+    }
+
+    void compararComDijkstra(const string& nome, const ConsultaPontoAPonto& consulta) {
+        cout << "\n👉 Número de consultas aleatórias (ex: 100): ";
+        int q;
+        cin >> q;
+        if (q <= 0) {
+            cout << "❌ Número inválido!\n";
+            return;
+        }
+
+        vector<int> origens = gerarVerticesAleatorios(q, numVertices);
+        vector<int> destinos = gerarVerticesAleatorios(q, numVertices);
+
+        double tempoAcelerado = 0.0;
+        double tempoDijkstra = 0.0;
+        long long visitadosAcelerado = 0;
+        int divergencias = 0;
+
+        for (int i = 0; i < q; i++) {
+            auto inicio = chrono::high_resolution_clock::now();
+            auto [distancia, caminho, visitados] = consulta(origens[i], destinos[i]);
+            auto meio = chrono::high_resolution_clock::now();
+            ResultadoDijkstra d = Dijkstra::dijkstraHeap(*listaPeso, origens[i]);
+            auto fim = chrono::high_resolution_clock::now();
+
+            tempoAcelerado += chrono::duration_cast<chrono::microseconds>(meio - inicio).count() / 1000.0;
+            tempoDijkstra += chrono::duration_cast<chrono::microseconds>(fim - meio).count() / 1000.0;
+            visitadosAcelerado += visitados;
+
+            double esperado = d.distancias[destinos[i] - 1];
+            if (!(distancia == esperado || abs(distancia - esperado) < 1e-9)) {
+                divergencias++;
+            }
+        }
+
+        cout << "\n📊 " << nome << " x DIJKSTRA (" << q << " consultas):\n";
+        cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+        cout << fixed << setprecision(3);
+        cout << "🔸 Tempo médio " << nome << ": " << tempoAcelerado / q << " ms\n";
+        cout << "🔸 Tempo médio Dijkstra (heap): " << tempoDijkstra / q << " ms\n";
+        cout << "🔸 Speedup: " << setprecision(2)
+             << (tempoAcelerado > 0 ? tempoDijkstra / tempoAcelerado : 0.0) << "x\n";
+        cout << "🔸 Vértices visitados por consulta (" << nome << "): "
+             << visitadosAcelerado / q << " de " << numVertices << "\n";
+        cout << "🔸 Resultados divergentes: " << divergencias << "\n";
+    }
+    
     void mostrarConfiguracaoAtual() {
         cout << "\n┌─────────────────────────────────────────────────────────────┐\n";
         cout << "│                    CONFIGURAÇÃO ATUAL                      │\n";
@@ -1162,6 +2627,16 @@ private:
         } else if (grafoPeso) {
             cout << "🔸 Dijkstra: ❌ Não configurado\n";
         }
+
+        if (!grafoPeso && !grafoSelecionado.empty()) {
+            cout << "🔸 Componentes: ✅ " << motorComponentes << "\n";
+        }
+
+        EstatisticasCache cache = cacheDijkstra.getEstatisticas();
+        if (cache.consultas > 0) {
+            cout << "🔸 Cache Dijkstra: " << cache.entradas << " árvores, " << cache.acertos << "/"
+                 << cache.consultas << " acertos\n";
+        }
     }
 
 public:
@@ -1181,14 +2656,16 @@ public:
             cout << "⚙️  CONFIGURAÇÃO:\n";
             cout << "   1. Selecionar grafo\n";
             cout << "   2. Definir estrutura de dados (matriz/lista)\n";
-            cout << "   3. Configurar Dijkstra (apenas grafos com peso)\n\n";
+            cout << "   3. Configurar Dijkstra (apenas grafos com peso)\n";
+            cout << "  10. Configurar componentes conexas (grafos sem peso)\n\n";
             
             cout << "🔍 ANÁLISES:\n";
             cout << "   4. Executar algoritmos de busca\n";
             cout << "   5. Analisar estatísticas do grafo\n";
             cout << "   6. Calcular distâncias (grafos sem peso)\n";
             cout << "   7. Benchmark Dijkstra (grafos com peso)\n";
-            cout << "   8. Consultar pesquisadores (nome/ID)\n\n";
+            cout << "   8. Consultar pesquisadores (nome/ID)\n";
+            cout << "   9. Consultas ponto-a-ponto aceleradas (grafos com peso)\n\n";
             
             cout << "   0. Sair\n\n";
             cout << "👉 Digite sua opção: ";
@@ -1220,6 +2697,12 @@ public:
                 case 8:
                     consultarPesquisadores();
                     break;
+                case 9:
+                    consultasAceleradas();
+                    break;
+                case 10:
+                    configurarComponentes();
+                    break;
                 case 0:
                     //limparTela();
                     cout << "👋 Obrigado por usar o Sistema de Análise de Grafos!\n";
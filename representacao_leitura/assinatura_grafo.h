@@ -0,0 +1,52 @@
+#ifndef ASSINATURA_GRAFO_H
+#define ASSINATURA_GRAFO_H
+
+#include <cstdint>
+#include <cstring>
+#include "grafo_interface.h"
+#include "grafo_peso_interface.h"
+using namespace std;
+
+// Assinatura de 64 bits da adjacência, gravada no cabeçalho dos arquivos de
+// pré-processamento (marcos, hierarquia, todos os pares, rótulos). Cobre o
+// número de vértices, a ordem dos vizinhos e, com peso, os bits de cada peso:
+// um arquivo gerado para outra versão do grafo é recusado e recalculado.
+
+// Passo do splitmix64 sobre o estado acumulado
+inline uint64_t misturarAssinatura(uint64_t estado, uint64_t valor) {
+    uint64_t z = estado + valor + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+inline uint64_t calcularAssinatura(const IGrafo& grafo) {
+    int n = grafo.getNumVertices();
+    uint64_t assinatura = misturarAssinatura(0, n);
+    for (int v = 0; v < n; v++) {
+        vector<int> vizinhos = grafo.getVizinhos(v);
+        assinatura = misturarAssinatura(assinatura, vizinhos.size());
+        for (int u : vizinhos) {
+            assinatura = misturarAssinatura(assinatura, u);
+        }
+    }
+    return assinatura;
+}
+
+inline uint64_t calcularAssinatura(const IGrafoPeso& grafo) {
+    int n = grafo.getNumVertices();
+    uint64_t assinatura = misturarAssinatura(0, n);
+    for (int v = 0; v < n; v++) {
+        vector<pair<int, double>> vizinhos = grafo.getVizinhosComPeso(v);
+        assinatura = misturarAssinatura(assinatura, vizinhos.size());
+        for (const auto& [u, peso] : vizinhos) {
+            uint64_t bits;
+            memcpy(&bits, &peso, sizeof(bits));
+            assinatura = misturarAssinatura(assinatura, u);
+            assinatura = misturarAssinatura(assinatura, bits);
+        }
+    }
+    return assinatura;
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include "grafo_csr.h"
+#include <stdexcept>
+
+GrafoCSR::GrafoCSR(const DadosGrafo& dados) {
+    n = dados.numVertices;
+    inicio.assign(n + 1, 0);
+
+    for (const auto& [u, v] : dados.arestas) {
+        if (u < 1 || u > n || v < 1 || v > n) {
+            throw invalid_argument("Vértice inválido");
+        }
+        inicio[u]++;
+        inicio[v]++;
+    }
+    for (int v = 0; v < n; v++) {
+        inicio[v + 1] += inicio[v];
+    }
+
+    // Preenche de trás para frente para manter a ordem do arquivo
+    vizinhos.resize(inicio[n]);
+    vector<long long> proxima(inicio.begin() + 1, inicio.end());
+    for (auto it = dados.arestas.rbegin(); it != dados.arestas.rend(); ++it) {
+        int u = it->first - 1;
+        int v = it->second - 1;
+        vizinhos[--proxima[v]] = u;
+        vizinhos[--proxima[u]] = v;
+    }
+}
+
+int GrafoCSR::getNumVertices() const {
+    return n;
+}
+
+int GrafoCSR::getGrau(int vertice) const {
+    return inicio[vertice + 1] - inicio[vertice];
+}
+
+const int* GrafoCSR::getVizinhos(int vertice) const {
+    return vizinhos.data() + inicio[vertice];
+}
+
+long long GrafoCSR::getNumEntradas() const {
+    return vizinhos.size();
+}
+
+size_t GrafoCSR::getMemoriaBytes() const {
+    return inicio.size() * sizeof(long long) + vizinhos.size() * sizeof(int);
+}
@@ -0,0 +1,35 @@
+#ifndef GRAFO_CSR_H
+#define GRAFO_CSR_H
+
+#include <vector>
+#include <cstddef>
+#include "leitor_grafo.h"
+using namespace std;
+
+// Adjacência compacta (CSR): os vizinhos de v ficam contíguos em
+// vizinhos[inicio[v] .. inicio[v + 1]), em base 0 e na ordem em que as
+// arestas aparecem no arquivo. Cada aresta não direcionada entra duas vezes.
+class GrafoCSR {
+private:
+    int n;
+    vector<long long> inicio; // n + 1 posições
+    vector<int> vizinhos;
+
+public:
+
+    GrafoCSR(const DadosGrafo& dados);
+
+    int getNumVertices() const;
+
+    // Vértice em base 0
+    int getGrau(int vertice) const;
+
+    // Primeiro vizinho do vértice (base 0); são getGrau(vertice) contíguos
+    const int* getVizinhos(int vertice) const;
+
+    long long getNumEntradas() const;
+
+    size_t getMemoriaBytes() const;
+};
+
+#endif
@@ -12,6 +12,9 @@ public:
 
     virtual vector<int> getVizinhos(int vertice) const = 0;
 
+    // Mesmo valor de getVizinhos(vertice).size(), sem montar a lista
+    virtual int getGrau(int vertice) const = 0;
+
     virtual bool existeAresta(int origem, int destino) const = 0;
 };
 
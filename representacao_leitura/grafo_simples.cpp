@@ -0,0 +1,85 @@
+#include "grafo_simples.h"
+#include <limits>
+#include <algorithm>
+
+template <typename LerVizinhos>
+void GrafoSimples::construir(bool comPeso, LerVizinhos lerVizinhos) {
+    menorPeso = numeric_limits<double>::infinity();
+
+    // marca[u] == v: u já é vizinho de v; marcar o próprio v descarta o laço
+    vector<int> marca(n, -1);
+    vector<long long> posicao(comPeso ? n : 0, 0);
+    inicio.assign(n + 1, 0);
+    for (int v = 0; v < n; v++) {
+        marca[v] = v;
+        lerVizinhos(v, [&](int u, double peso) {
+            if (marca[u] != v) {
+                marca[u] = v;
+                if (comPeso) {
+                    posicao[u] = vizinhos.size();
+                    pesos.push_back(peso);
+                    menorPeso = min(menorPeso, peso);
+                }
+                vizinhos.push_back(u);
+            } else if (comPeso && u != v) {
+                pesos[posicao[u]] = min(pesos[posicao[u]], peso);
+                menorPeso = min(menorPeso, peso);
+            }
+        });
+        inicio[v + 1] = vizinhos.size();
+    }
+}
+
+GrafoSimples::GrafoSimples(const IGrafo& grafo) : n(grafo.getNumVertices()) {
+    construir(false, [&](int v, auto adicionar) {
+        for (int u : grafo.getVizinhos(v)) {
+            adicionar(u, 1.0);
+        }
+    });
+}
+
+GrafoSimples::GrafoSimples(const IGrafoPeso& grafo) : n(grafo.getNumVertices()) {
+    construir(true, [&](int v, auto adicionar) {
+        for (const auto& [u, peso] : grafo.getVizinhosComPeso(v)) {
+            adicionar(u, peso);
+        }
+    });
+}
+
+GrafoSimples::GrafoSimples(const GrafoCSR& grafo) : n(grafo.getNumVertices()) {
+    vizinhos.reserve(grafo.getNumEntradas());
+    construir(false, [&](int v, auto adicionar) {
+        const int* lista = grafo.getVizinhos(v);
+        for (int i = 0; i < grafo.getGrau(v); i++) {
+            adicionar(lista[i], 1.0);
+        }
+    });
+}
+
+int GrafoSimples::getNumVertices() const {
+    return n;
+}
+
+int GrafoSimples::getGrau(int vertice) const {
+    return inicio[vertice + 1] - inicio[vertice];
+}
+
+const vector<long long>& GrafoSimples::getInicio() const {
+    return inicio;
+}
+
+const vector<int>& GrafoSimples::getVizinhos() const {
+    return vizinhos;
+}
+
+const vector<double>& GrafoSimples::getPesos() const {
+    return pesos;
+}
+
+double GrafoSimples::getMenorPeso() const {
+    return menorPeso;
+}
+
+long long GrafoSimples::getNumEntradas() const {
+    return vizinhos.size();
+}
@@ -0,0 +1,51 @@
+#ifndef GRAFO_SIMPLES_H
+#define GRAFO_SIMPLES_H
+
+#include <vector>
+#include <cstddef>
+#include "grafo_interface.h"
+#include "grafo_peso_interface.h"
+#include "grafo_csr.h"
+using namespace std;
+
+// Adjacência compacta (CSR) do grafo simples subjacente: sem laços e com uma
+// entrada por par de vizinhos; de arestas paralelas com peso fica a de menor
+// peso, como na matriz de adjacência com peso. Assim lista e matriz produzem
+// a mesma adjacência. Vizinhos de v em vizinhos[inicio[v] .. inicio[v + 1]),
+// em base 0 e na ordem da primeira ocorrência; pesos só com peso.
+class GrafoSimples {
+private:
+    int n;
+    vector<long long> inicio; // n + 1 posições
+    vector<int> vizinhos;
+    vector<double> pesos;
+    double menorPeso;
+
+    // lerVizinhos(v, adicionar) chama adicionar(u, peso) para cada vizinho u de v
+    template <typename LerVizinhos>
+    void construir(bool comPeso, LerVizinhos lerVizinhos);
+
+public:
+    explicit GrafoSimples(const IGrafo& grafo);
+    explicit GrafoSimples(const IGrafoPeso& grafo);
+    explicit GrafoSimples(const GrafoCSR& grafo);
+
+    int getNumVertices() const;
+
+    // Vértice em base 0
+    int getGrau(int vertice) const;
+
+    const vector<long long>& getInicio() const;
+
+    const vector<int>& getVizinhos() const;
+
+    // Paralelo a getVizinhos; vazio sem peso
+    const vector<double>& getPesos() const;
+
+    // Menor peso de aresta (infinito sem arestas ou sem peso)
+    double getMenorPeso() const;
+
+    long long getNumEntradas() const;
+};
+
+#endif
@@ -29,6 +29,10 @@ public:
         return vizinhos_0based;
     }
 
+    int getGrau(int vertice) const override {
+        return lista.getLista()[vertice].size();
+    }
+
     bool existeAresta(int origem, int destino) const override {
         const auto& L = lista.getLista();
         const auto& vizinhos = L[origem];
@@ -8,7 +8,10 @@
 ListaAdjacenciaPeso::ListaAdjacenciaPeso(const DadosGrafoPeso& dados) {
     n = dados.numVertices;
     lista.resize(n);
+    dominio = DominioPesos::UNIFORME;
+    pesoUniforme = 1.0;
 
+    bool primeiro = true;
     for (const auto& aresta : dados.arestas) {
         int u = get<0>(aresta) - 1;
         int v = get<1>(aresta) - 1;
@@ -16,6 +19,30 @@ ListaAdjacenciaPeso::ListaAdjacenciaPeso(const DadosGrafoPeso& dados) {
 
         lista[u].push_back({v + 1, peso});
         lista[v].push_back({u + 1, peso});
+
+        registrarPeso(peso, primeiro);
+        primeiro = false;
+    }
+}
+
+void ListaAdjacenciaPeso::registrarPeso(double peso, bool primeiro) {
+    bool zeroOuUm = (peso == 0.0 || peso == 1.0);
+
+    if (primeiro) {
+        if (peso > 0.0) {
+            dominio = DominioPesos::UNIFORME;
+            pesoUniforme = peso;
+        } else {
+            dominio = zeroOuUm ? DominioPesos::ZERO_UM : DominioPesos::GERAL;
+        }
+        return;
+    }
+
+    if (dominio == DominioPesos::UNIFORME && peso != pesoUniforme) {
+        // Uniforme com peso 1 e um peso 0 ainda cabe na 0-1 BFS
+        dominio = (pesoUniforme == 1.0 && zeroOuUm) ? DominioPesos::ZERO_UM : DominioPesos::GERAL;
+    } else if (dominio == DominioPesos::ZERO_UM && !zeroOuUm) {
+        dominio = DominioPesos::GERAL;
     }
 }
 
@@ -83,4 +110,62 @@ const vector<vector<pair<int, double>>>& ListaAdjacenciaPeso::getLista() const {
 
 int ListaAdjacenciaPeso::getNumVertices() const {
     return n;
-}
\ No newline at end of file
+}
+
+DominioPesos ListaAdjacenciaPeso::getDominioPesos() const {
+    return dominio;
+}
+
+double ListaAdjacenciaPeso::getPesoUniforme() const {
+    return pesoUniforme;
+}
+
+void ListaAdjacenciaPeso::definirAresta(int u, int v, double peso) {
+    if (u < 1 || u > n || v < 1 || v > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+    if (peso < 0) {
+        throw invalid_argument("Peso negativo não suportado");
+    }
+
+    auto atualizar = [&](int de, int para) {
+        bool encontrada = false;
+        for (auto& [vizinho, p] : lista[de - 1]) {
+            if (vizinho == para) {
+                p = peso;
+                encontrada = true;
+            }
+        }
+        if (!encontrada) {
+            lista[de - 1].push_back({para, peso});
+        }
+    };
+
+    atualizar(u, v);
+    if (u != v) {
+        atualizar(v, u);
+    }
+
+    registrarPeso(peso, false);
+}
+
+bool ListaAdjacenciaPeso::removerAresta(int u, int v) {
+    if (u < 1 || u > n || v < 1 || v > n) {
+        throw invalid_argument("Vértice inválido");
+    }
+
+    auto remover = [&](int de, int para) {
+        auto& vizinhos = lista[de - 1];
+        size_t antes = vizinhos.size();
+        vizinhos.erase(remove_if(vizinhos.begin(), vizinhos.end(),
+                                 [para](const pair<int, double>& a) { return a.first == para; }),
+                       vizinhos.end());
+        return vizinhos.size() != antes;
+    };
+
+    bool removida = remover(u, v);
+    if (u != v) {
+        remover(v, u);
+    }
+    return removida;
+}
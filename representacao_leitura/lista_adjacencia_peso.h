@@ -7,10 +7,22 @@
 #include "leitor_grafo.h"
 using namespace std;
 
+// Domínio dos pesos, detectado na carga para escolher o motor de caminhos mínimos
+enum class DominioPesos {
+    UNIFORME, // todas as arestas com o mesmo peso positivo
+    ZERO_UM,  // apenas pesos 0 e 1
+    GERAL
+};
+
 class ListaAdjacenciaPeso {
 private:
     int n;
     vector<vector<pair<int, double>>> lista;
+    DominioPesos dominio;
+    double pesoUniforme; // válido quando dominio == UNIFORME
+
+    // Ajusta o domínio para incluir um novo peso (nunca o torna mais restrito)
+    void registrarPeso(double peso, bool primeiro);
 
     vector<vector<pair<int, double>>> getListaOrdenada() const;
 
@@ -25,6 +37,18 @@ public:
     const vector<vector<pair<int, double>>>& getLista() const;
 
     int getNumVertices() const;
+
+    DominioPesos getDominioPesos() const;
+
+    double getPesoUniforme() const;
+
+    // Vértices em base 1. Insere a aresta u-v ou troca o peso de todas as
+    // cópias existentes (arestas paralelas passam a ter o mesmo peso).
+    void definirAresta(int u, int v, double peso);
+
+    // Remove todas as cópias da aresta u-v; retorna false se ela não existir.
+    // O domínio dos pesos é mantido (continua válido, só pode ser mais geral).
+    bool removerAresta(int u, int v);
 };
 
 #endif
\ No newline at end of file
@@ -6,12 +6,20 @@
 MatrizAdjacencia::MatrizAdjacencia(const DadosGrafo& dados) {
     n = dados.numVertices;
     matriz.assign(n, vector<uint8_t>(n, 0));
+    graus.assign(n, 0);
 
+    // Arestas repetidas não mudam a matriz nem o grau; um laço conta uma vez
     for (const auto& aresta : dados.arestas) {
         int u = aresta.first;
         int v = aresta.second;
-        matriz[u-1][v-1] = 1;
-        matriz[v-1][u-1] = 1;
+        if (!matriz[u-1][v-1]) {
+            matriz[u-1][v-1] = 1;
+            graus[u-1]++;
+        }
+        if (!matriz[v-1][u-1]) {
+            matriz[v-1][u-1] = 1;
+            graus[v-1]++;
+        }
     }
 }
 
@@ -49,3 +57,7 @@ void MatrizAdjacencia::imprimir() const {
 const vector<vector<uint8_t>>& MatrizAdjacencia::getMatriz() const {
     return matriz;
 }
+
+int MatrizAdjacencia::getGrau(int vertice) const {
+    return graus[vertice];
+}
@@ -11,6 +11,7 @@ class MatrizAdjacencia {
 private:
     int n;
     vector<vector<uint8_t>> matriz;
+    vector<int> graus; // uns de cada linha, contados na construção
 
 public:
 
@@ -21,6 +22,9 @@ public:
     void imprimir() const;
 
     const vector<vector<uint8_t>>& getMatriz() const;
+
+    // Vértice em base 0
+    int getGrau(int vertice) const;
 };
 
 #endif
@@ -29,6 +29,10 @@ public:
         return vizinhos;
     }
 
+    int getGrau(int vertice) const override {
+        return matriz.getGrau(vertice);
+    }
+
     bool existeAresta(int origem, int destino) const override {
         const auto& M = matriz.getMatriz();
         return M[origem][destino] == 1;
@@ -0,0 +1,77 @@
+#include "matriz_adjacencia_peso.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <limits>
+#include <iomanip>
+
+MatrizAdjacenciaPeso::MatrizAdjacenciaPeso(const DadosGrafoPeso& dados) {
+    n = dados.numVertices;
+    pesos.assign(static_cast<size_t>(n) * n, numeric_limits<double>::infinity());
+
+    for (const auto& aresta : dados.arestas) {
+        int u = get<0>(aresta) - 1;
+        int v = get<1>(aresta) - 1;
+        double peso = get<2>(aresta);
+
+        double& uv = pesos[static_cast<size_t>(u) * n + v];
+        double& vu = pesos[static_cast<size_t>(v) * n + u];
+        if (peso < uv) uv = peso;
+        if (peso < vu) vu = peso;
+    }
+}
+
+void MatrizAdjacenciaPeso::salvarEmArquivo(const string& nomeSaida) const {
+    ofstream saida(nomeSaida);
+    if (!saida) {
+        throw runtime_error("Erro ao criar arquivo de saída");
+    }
+
+    saida << "Matriz de Adjacencia com Peso (" << n << "x" << n << "):\n";
+    saida << fixed << setprecision(1);
+
+    for (int i = 0; i < n; i++) {
+        const double* linha = getLinha(i);
+        for (int j = 0; j < n; j++) {
+            if (linha[j] == numeric_limits<double>::infinity()) {
+                saida << "- ";
+            } else {
+                saida << linha[j] << " ";
+            }
+        }
+        saida << "\n";
+    }
+}
+
+void MatrizAdjacenciaPeso::imprimir() const {
+    cout << "Matriz de Adjacencia com Peso (" << n << "x" << n << "):\n";
+    cout << fixed << setprecision(1);
+
+    for (int i = 0; i < n; i++) {
+        const double* linha = getLinha(i);
+        for (int j = 0; j < n; j++) {
+            if (linha[j] == numeric_limits<double>::infinity()) {
+                cout << "- ";
+            } else {
+                cout << linha[j] << " ";
+            }
+        }
+        cout << "\n";
+    }
+}
+
+const double* MatrizAdjacenciaPeso::getLinha(int vertice) const {
+    return pesos.data() + static_cast<size_t>(vertice) * n;
+}
+
+double MatrizAdjacenciaPeso::getPeso(int origem, int destino) const {
+    return pesos[static_cast<size_t>(origem) * n + destino];
+}
+
+int MatrizAdjacenciaPeso::getNumVertices() const {
+    return n;
+}
+
+size_t MatrizAdjacenciaPeso::memoriaNecessaria(int numVertices) {
+    return static_cast<size_t>(numVertices) * numVertices * sizeof(double);
+}
@@ -0,0 +1,37 @@
+#ifndef MATRIZ_ADJACENCIA_PESO_H
+#define MATRIZ_ADJACENCIA_PESO_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <tuple>
+#include "leitor_grafo.h"
+using namespace std;
+
+// Matriz de pesos n x n contígua, em ordem de linhas. Ausência de aresta é
+// +infinito; com arestas paralelas, vale o menor peso.
+class MatrizAdjacenciaPeso {
+private:
+    int n;
+    vector<double> pesos;
+
+public:
+
+    MatrizAdjacenciaPeso(const DadosGrafoPeso& dados);
+
+    void salvarEmArquivo(const string& nomeSaida) const;
+
+    void imprimir() const;
+
+    // Linha do vértice em base 0 (n pesos contíguos)
+    const double* getLinha(int vertice) const;
+
+    // Vértices em base 0; +infinito se não houver aresta
+    double getPeso(int origem, int destino) const;
+
+    int getNumVertices() const;
+
+    static size_t memoriaNecessaria(int numVertices);
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef MATRIZ_ADJACENCIA_PESO_ADAPTER_H
+#define MATRIZ_ADJACENCIA_PESO_ADAPTER_H
+
+#include <limits>
+#include "grafo_peso_interface.h"
+#include "matriz_adjacencia_peso.h"
+
+class MatrizAdjacenciaPesoAdapter : public IGrafoPeso {
+private:
+    const MatrizAdjacenciaPeso& matriz;
+
+public:
+    explicit MatrizAdjacenciaPesoAdapter(const MatrizAdjacenciaPeso& m) : matriz(m) {}
+
+    int getNumVertices() const override {
+        return matriz.getNumVertices();
+    }
+
+    vector<pair<int, double>> getVizinhosComPeso(int vertice) const override {
+        vector<pair<int, double>> vizinhos;
+        const double* linha = matriz.getLinha(vertice);
+        int n = matriz.getNumVertices();
+
+        for (int i = 0; i < n; i++) {
+            if (linha[i] != numeric_limits<double>::infinity()) {
+                vizinhos.emplace_back(i, linha[i]);
+            }
+        }
+
+        return vizinhos;
+    }
+
+    pair<bool, double> getAresta(int origem, int destino) const override {
+        double peso = matriz.getPeso(origem, destino);
+        if (peso == numeric_limits<double>::infinity()) {
+            return {false, 0.0};
+        }
+        return {true, peso};
+    }
+};
+
+#endif